@@ -0,0 +1,90 @@
+// Read wakeup latency with and without busy-poll (serialSetBusyPoll()). A thread on the pty master echoes every
+// byte straight back, so each iteration is one write plus the time until the reply reaches the reader; the tail
+// of the distribution is where the scheduler wakeup of a blocking wait shows.
+
+#include <cpp_bindings_linux/interface/serial_low_latency.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <poll.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+auto percentileUs(std::vector<int64_t> &samples_ns, double percentile) -> double
+{
+    const auto index = static_cast<std::size_t>(percentile * static_cast<double>(samples_ns.size() - 1));
+    std::nth_element(samples_ns.begin(), samples_ns.begin() + static_cast<std::ptrdiff_t>(index), samples_ns.end());
+    return static_cast<double>(samples_ns[index]) / 1e3;
+}
+
+auto readLatency(benchmark::State &state) -> void
+{
+    const int64_t spin_ns = state.range(0);
+
+    PtyPair pty;
+    const int64_t handle = pty.valid() ? pty.openSlave() : -1;
+    if (handle <= 0 || serialSetBusyPoll(handle, spin_ns, nullptr) != 0)
+    {
+        state.SkipWithError("No pseudo-terminal available");
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::jthread echo([&pty, &stop] {
+        std::array<char, 64> bytes{};
+        while (!stop.load())
+        {
+            struct pollfd poll_fd = {pty.master_fd, POLLIN, 0};
+            if (poll(&poll_fd, 1, 10) > 0)
+            {
+                const ssize_t count = read(pty.master_fd, bytes.data(), bytes.size());
+                if (count > 0)
+                {
+                    (void)write(pty.master_fd, bytes.data(), static_cast<std::size_t>(count));
+                }
+            }
+        }
+    });
+
+    std::vector<int64_t> samples_ns;
+    std::array<char, 64> buffer{};
+    const char ping = 'p';
+    for (auto _ : state)
+    {
+        const auto start = Clock::now();
+        if (serialWrite(handle, &ping, 1, 100, 0, nullptr) != 1 ||
+            serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, nullptr) != 1)
+        {
+            state.SkipWithError("echo timed out");
+            break;
+        }
+        samples_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+    stop.store(true);
+
+    if (!samples_ns.empty())
+    {
+        state.counters["p50_us"] = percentileUs(samples_ns, 0.50);
+        state.counters["p99_us"] = percentileUs(samples_ns, 0.99);
+        state.counters["max_us"] = percentileUs(samples_ns, 1.0);
+    }
+    serialClose(handle, nullptr);
+}
+} // namespace
+
+// 0 = blocking wait only; 200 µs = spin first.
+BENCHMARK(readLatency)->Arg(0)->Arg(200'000)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "detail/crc.hpp"
+
+namespace
+{
+using CrcKernel = uint32_t (*)(const unsigned char *, std::size_t);
+
+auto randomBytes(std::size_t size) -> std::vector<unsigned char>
+{
+    std::mt19937 rng(42);
+    std::vector<unsigned char> data(size);
+    for (auto &byte : data)
+    {
+        byte = static_cast<unsigned char>(rng());
+    }
+    return data;
+}
+
+auto runKernel(benchmark::State &state, CrcKernel kernel) -> void
+{
+    const auto data = randomBytes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(kernel(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+auto runHardwareKernel(benchmark::State &state, CrcKernel kernel, bool supported) -> void
+{
+    if (!supported)
+    {
+        state.SkipWithError("CPU does not support this kernel");
+        return;
+    }
+    runKernel(state, kernel);
+}
+
+// Typical frame sizes: Modbus RTU (8..256), bulk transfer chunks (4096), firmware images (64 KiB).
+auto frameSizes(benchmark::internal::Benchmark *bench) -> void
+{
+    for (const int64_t size : {8, 64, 256, 4096, 65536})
+    {
+        bench->Arg(size);
+    }
+}
+} // namespace
+
+BENCHMARK_CAPTURE(runKernel, crc16_modbus_bytewise, cpp_bindings_linux::detail::crc16ModbusBytewise)
+    ->Apply(frameSizes);
+BENCHMARK_CAPTURE(runKernel, crc16_modbus_slice8, cpp_bindings_linux::detail::crc16ModbusSlice8)->Apply(frameSizes);
+BENCHMARK_CAPTURE(runKernel, crc16_ccitt_bytewise, cpp_bindings_linux::detail::crc16CcittBytewise)
+    ->Apply(frameSizes);
+BENCHMARK_CAPTURE(runKernel, crc16_ccitt_slice8, cpp_bindings_linux::detail::crc16CcittSlice8)->Apply(frameSizes);
+BENCHMARK_CAPTURE(runKernel, crc32_bytewise, cpp_bindings_linux::detail::crc32Bytewise)->Apply(frameSizes);
+BENCHMARK_CAPTURE(runKernel, crc32_slice8, cpp_bindings_linux::detail::crc32Slice8)->Apply(frameSizes);
+BENCHMARK_CAPTURE(runHardwareKernel, crc32_pclmul, cpp_bindings_linux::detail::crc32Pclmul,
+                  cpp_bindings_linux::detail::hasCrc32Pclmul())
+    ->Apply(frameSizes);
+BENCHMARK_CAPTURE(runKernel, crc32c_bytewise, cpp_bindings_linux::detail::crc32cBytewise)->Apply(frameSizes);
+BENCHMARK_CAPTURE(runKernel, crc32c_slice8, cpp_bindings_linux::detail::crc32cSlice8)->Apply(frameSizes);
+BENCHMARK_CAPTURE(runHardwareKernel, crc32c_sse42, cpp_bindings_linux::detail::crc32cSse42,
+                  cpp_bindings_linux::detail::hasCrc32cSse42())
+    ->Apply(frameSizes);
@@ -0,0 +1,88 @@
+// Compressed-stream mode (serialSetCompression) over a pty pair, with this library on both ends: codec throughput
+// and the compression ratio for telemetry-like records. The ratio is what a slow link gains, since the wire time
+// per raw byte shrinks by the same factor.
+
+#include <cpp_bindings_linux/interface/serial_compression.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+
+#include <array>
+#include <cstdio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+auto telemetryBatch(int records) -> std::string
+{
+    std::string batch;
+    for (int sequence = 0; sequence < records; ++sequence)
+    {
+        std::array<char, 96> line{};
+        const int length =
+            std::snprintf(line.data(), line.size(), "seq=%06d temp=%.1f hum=%d press=1013.%d status=OK\n", sequence,
+                          21.5 + (sequence % 7) * 0.1, 40 + (sequence % 3), sequence % 10);
+        batch.append(line.data(), static_cast<std::size_t>(length));
+    }
+    return batch;
+}
+
+auto compressedLink(benchmark::State &state) -> void
+{
+    const bool compressed = state.range(0) != 0;
+    const auto records = static_cast<int>(state.range(1));
+
+    PtyPair pty;
+    const int64_t host = pty.valid() ? pty.openSlave() : -1;
+    if (host <= 0)
+    {
+        state.SkipWithError("No pseudo-terminal available");
+        return;
+    }
+    // The master end gets per-port state too, standing in for the library on the device side.
+    const RegisteredMaster device_state(pty.master_fd, 57600);
+    serialSetCompression(host, compressed ? 1 : 0, nullptr);
+    serialSetCompression(pty.master_fd, compressed ? 1 : 0, nullptr);
+
+    const std::string batch = telemetryBatch(records);
+    std::array<char, 4096> buffer{};
+    for (auto _ : state)
+    {
+        // One record per write, as a telemetry source would send them. A batch stays well below the pty buffer,
+        // so writing it all before reading never blocks.
+        std::size_t offset = 0;
+        while (offset < batch.size())
+        {
+            const std::size_t end = batch.find('\n', offset) + 1;
+            serialWrite(pty.master_fd, batch.data() + offset, static_cast<int>(end - offset), 1000, 0, nullptr);
+            offset = end;
+        }
+        std::size_t received = 0;
+        while (received < batch.size())
+        {
+            const int bytes = serialRead(host, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, nullptr);
+            if (bytes <= 0)
+            {
+                state.SkipWithError("read timed out");
+                break;
+            }
+            received += static_cast<std::size_t>(bytes);
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(batch.size()));
+    SerialCompressionStats stats{};
+    if (compressed && serialGetCompressionStats(host, &stats, nullptr) == 0 && stats.wire_rx_bytes > 0)
+    {
+        state.counters["ratio"] = static_cast<double>(stats.raw_rx_bytes) / static_cast<double>(stats.wire_rx_bytes);
+    }
+
+    serialClose(host, nullptr);
+}
+} // namespace
+
+BENCHMARK(compressedLink)->ArgsProduct({{0, 1}, {16, 64}})->ArgNames({"compressed", "records"});
@@ -0,0 +1,62 @@
+// Round trips through a simulated device (src/test_helpers/virtual_device.hpp) at real wire speeds: what a caller
+// actually observes end to end, including pacing, instead of pipe-speed micro-benchmarks.
+
+#include <cpp_bindings_linux/interface/serial_write_all.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+
+#include <array>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "test_helpers/virtual_device.hpp"
+
+namespace
+{
+auto echoRoundTrip(benchmark::State &state) -> void
+{
+    const auto baudrate = static_cast<int>(state.range(0));
+    const auto frame_size = static_cast<int>(state.range(1));
+
+    VirtualDevice device(VirtualDeviceOptions{.baudrate = baudrate}, VirtualDevice::echo());
+    const int64_t handle = device.valid() ? device.openHost() : -1;
+    if (handle <= 0)
+    {
+        state.SkipWithError("No pseudo-terminal available");
+        return;
+    }
+
+    const std::string frame(static_cast<std::size_t>(frame_size), 'f');
+    std::array<char, 4096> buffer{};
+    for (auto _ : state)
+    {
+        if (serialWriteAll(handle, frame.data(), frame_size, 5000, 0, nullptr) != frame_size)
+        {
+            state.SkipWithError("write failed");
+            break;
+        }
+        int received = 0;
+        while (received < frame_size)
+        {
+            const int bytes = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, nullptr);
+            if (bytes <= 0)
+            {
+                state.SkipWithError("read timed out");
+                break;
+            }
+            received += bytes;
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * frame_size);
+    // Lower bound per iteration: the echo is pipelined, so a frame costs about one wire time, not two.
+    state.counters["wire_ms"] = frame_size * static_cast<double>(device.characterTime().count()) / 1e6;
+    serialClose(handle, nullptr);
+}
+} // namespace
+
+BENCHMARK(echoRoundTrip)
+    ->ArgsProduct({{115200, 921600}, {16, 256}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <unistd.h>
+
+namespace cpp_bindings_linux::detail
+{
+// Owning file descriptor: closes on destruction, move-only.
+class UniqueFd
+{
+  public:
+    UniqueFd() = default;
+    explicit UniqueFd(int in_fd) : fd_(in_fd)
+    {
+    }
+
+    UniqueFd(const UniqueFd &) = delete;
+    auto operator=(const UniqueFd &) -> UniqueFd & = delete;
+
+    UniqueFd(UniqueFd &&other) noexcept : fd_(other.fd_)
+    {
+        other.fd_ = -1;
+    }
+    auto operator=(UniqueFd &&other) noexcept -> UniqueFd &
+    {
+        if (this != &other)
+        {
+            reset(other.release());
+        }
+        return *this;
+    }
+
+    ~UniqueFd()
+    {
+        reset(-1);
+    }
+
+    [[nodiscard]] auto get() const -> int
+    {
+        return fd_;
+    }
+    [[nodiscard]] auto valid() const -> bool
+    {
+        return fd_ >= 0;
+    }
+
+    auto reset(int new_fd) -> void
+    {
+        if (fd_ >= 0)
+        {
+            close(fd_);
+        }
+        fd_ = new_fd;
+    }
+
+    [[nodiscard]] auto release() -> int
+    {
+        const int out = fd_;
+        fd_ = -1;
+        return out;
+    }
+
+  private:
+    int fd_ = -1;
+};
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cpp_bindings_linux/detail/unique_fd.hpp>
+#include <cpp_bindings_linux/serial_error.hpp>
+#include <cpp_bindings_linux/serial_port.hpp>
+#include <cpp_bindings_linux/task.hpp>
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <span>
+
+namespace cpp_bindings_linux
+{
+class EventLoop;
+
+namespace detail
+{
+// A coroutine suspended until a descriptor becomes ready. It lives inside the awaiting coroutine frame, so
+// registering a wait allocates nothing beyond the loop's own bookkeeping.
+struct FdWaiter
+{
+    int fd = -1;
+    bool for_read = true;
+    int64_t deadline_ns = 0;
+    std::coroutine_handle<> handle;
+    bool timed_out = false;
+    int error_number = 0;
+    std::multimap<int64_t, FdWaiter *>::iterator timer;
+};
+} // namespace detail
+
+/** @brief Awaitable returned by EventLoop::readable()/writable(). Yields true when ready, false on timeout. */
+class ReadinessAwaitable
+{
+  public:
+    ReadinessAwaitable(EventLoop &loop, int fd, bool for_read, std::chrono::milliseconds timeout) noexcept;
+
+    [[nodiscard]] auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    auto await_suspend(std::coroutine_handle<> handle) -> bool;
+
+    [[nodiscard]] auto await_resume() const -> SerialResult<bool>;
+
+  private:
+    EventLoop *loop_;
+    detail::FdWaiter waiter_;
+};
+
+/**
+ * @brief Single-threaded epoll reactor that drives the coroutine API.
+ *
+ * Every pending operation is a suspended coroutine plus one entry in the loop, so thousands of in-flight reads
+ * and writes cost coroutine frames instead of threads. All awaits and resumptions happen on the thread that
+ * calls run()/runOnce().
+ *
+ * To plug it into an existing loop, watch nativeHandle() for readability there and call runOnce(0ms) whenever it
+ * fires.
+ */
+class EventLoop
+{
+  public:
+    [[nodiscard]] static auto create() -> SerialResult<std::unique_ptr<EventLoop>>;
+
+    EventLoop(const EventLoop &) = delete;
+    auto operator=(const EventLoop &) -> EventLoop & = delete;
+    EventLoop(EventLoop &&) = delete;
+    auto operator=(EventLoop &&) -> EventLoop & = delete;
+    ~EventLoop();
+
+    /** @brief The epoll descriptor; readable whenever runOnce() has work to do. */
+    [[nodiscard]] auto nativeHandle() const noexcept -> int
+    {
+        return epoll_fd_.get();
+    }
+
+    /** @brief Suspend until @p fd is readable (or hung up), or until @p timeout passes. */
+    [[nodiscard]] auto readable(int fd, std::chrono::milliseconds timeout) -> ReadinessAwaitable
+    {
+        return {*this, fd, true, timeout};
+    }
+
+    /** @brief Suspend until @p fd is writable (or hung up), or until @p timeout passes. */
+    [[nodiscard]] auto writable(int fd, std::chrono::milliseconds timeout) -> ReadinessAwaitable
+    {
+        return {*this, fd, false, timeout};
+    }
+
+    /** @brief Start @p task now; the loop keeps its frame alive until it finishes. */
+    auto spawn(Task<void> task) -> void;
+
+    /**
+     * @brief Wait up to @p timeout for events, then resume every coroutine whose descriptor became ready or
+     * whose deadline passed.
+     *
+     * @return Number of coroutines resumed, or the error of the failed epoll_wait().
+     */
+    auto runOnce(std::chrono::milliseconds timeout) -> SerialResult<std::size_t>;
+
+    /** @brief Call runOnce() until no coroutine is waiting on the loop. */
+    auto run() -> SerialResult<void>;
+
+    /** @brief Number of coroutines currently suspended on this loop. */
+    [[nodiscard]] auto pendingWaits() const noexcept -> std::size_t;
+
+  private:
+    friend class ReadinessAwaitable;
+
+    struct State;
+
+    explicit EventLoop(detail::UniqueFd epoll_fd);
+
+    // Registers the waiter. Returns false (with error_number set) if the descriptor cannot be watched.
+    auto suspend(detail::FdWaiter &waiter) -> bool;
+
+    detail::UniqueFd epoll_fd_;
+    std::unique_ptr<State> state_;
+};
+
+/** @brief Result of asyncReadUntil(). */
+struct ReadUntilResult
+{
+    std::size_t bytes_read = 0; ///< Bytes stored in the buffer, possibly past the delimiter
+    std::size_t frame_size = 0; ///< Bytes up to and including the delimiter; 0 if it was not seen
+};
+
+/**
+ * @brief Coroutine version of SerialPortView::read(): suspend until data arrives, then read it.
+ *
+ * Performs one readiness wait and one read(). Returns 0 bytes on timeout.
+ */
+[[nodiscard]] auto asyncRead(EventLoop &loop, SerialPortView port, std::span<std::byte> buffer,
+                             std::chrono::milliseconds timeout) -> Task<SerialResult<std::size_t>>;
+
+/**
+ * @brief Write all of @p data, suspending whenever the output queue is full, within one overall @p timeout.
+ *
+ * Unlike SerialPortView::write() this does not drain the output queue, because tcdrain() would block the loop.
+ *
+ * @return Bytes accepted by the kernel; fewer than data.size() only on timeout.
+ */
+[[nodiscard]] auto asyncWrite(EventLoop &loop, SerialPortView port, std::span<const std::byte> data,
+                              std::chrono::milliseconds timeout) -> Task<SerialResult<std::size_t>>;
+
+/**
+ * @brief Read until @p delimiter arrives, the buffer is full, or @p timeout passes.
+ *
+ * Bytes that arrive in the same chunk as the delimiter are kept in the buffer after the frame (bytes_read >
+ * frame_size); the caller decides what to do with them.
+ */
+[[nodiscard]] auto asyncReadUntil(EventLoop &loop, SerialPortView port, std::span<std::byte> buffer,
+                                  std::byte delimiter, std::chrono::milliseconds timeout)
+    -> Task<SerialResult<ReadUntilResult>>;
+
+} // namespace cpp_bindings_linux
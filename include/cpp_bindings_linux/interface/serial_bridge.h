@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /// Flags for serialBridgeStart().
+    enum SerialBridgeFlags
+    {
+        kSerialBridgeToFd = 1,     ///< Forward bytes received on the port to the descriptor.
+        kSerialBridgeFromFd = 2,   ///< Forward bytes read from the descriptor to the port.
+        kSerialBridgeCopyOnly = 4, ///< Never use splice(); always copy through a userspace buffer.
+    };
+
+    /**
+     * @brief Throughput counters of a bridge (serialBridgeStats()).
+     *
+     * Layout is fixed (64 bytes, 8-byte aligned) so FFI callers can pass a plain byte buffer.
+     */
+    struct SerialBridgeStats
+    {
+        uint64_t bytes_to_fd;           ///< Port -> descriptor, in total.
+        uint64_t bytes_from_fd;         ///< Descriptor -> port, in total.
+        uint64_t spliced_bytes;         ///< Part of both totals moved by splice(), i.e. never copied to userspace.
+        uint64_t to_fd_bytes_per_sec;   ///< bytes_to_fd averaged over elapsed_ns.
+        uint64_t from_fd_bytes_per_sec; ///< bytes_from_fd averaged over elapsed_ns.
+        int64_t elapsed_ns;             ///< Time since serialBridgeStart().
+        int32_t active_directions;      ///< kSerialBridgeToFd / kSerialBridgeFromFd bits still forwarding.
+        int32_t error_number;           ///< errno that stopped a direction, or 0 (end of file is not an error).
+        int64_t reserved;               ///< Set to 0.
+    };
+
+    /**
+     * @brief Forward data between a handle and another file descriptor on the library's bridge thread.
+     *
+     * Logging a port to a file, or connecting it to a pipe or local socket, otherwise takes a serialRead() into
+     * the caller and a write() back out per chunk. A bridge moves the bytes inside the library instead: with
+     * splice() through a pipe where both descriptors support it, so the data never leaves the kernel, and with a
+     * plain read()/write() copy loop otherwise (decided per direction, at the first transfer). All bridges share
+     * one thread that waits for every descriptor in a single poll().
+     *
+     * Raw bytes are forwarded and write pacing is bypassed. A handle in compressed-stream mode is refused with
+     * kReadError/kWriteError, and a direction whose port side enters that mode later ends with EPROTO. Forwarding
+     * to the descriptor is refused in fan-out mode, and ends with EBUSY if fan-out is enabled later. Reads on the
+     * port by other callers take bytes away from a bridge forwarding to the descriptor. The bridge does not own
+     * @p fd and does not change its flags; a descriptor that may block on write (e.g. a blocking socket) should be
+     * non-blocking, or it can stall every bridge. A direction ends at end of file or on the first error (see
+     * SerialBridgeStats).
+     *
+     * @param fd    Descriptor to forward to/from (file, pipe, socket, another tty, ...).
+     * @param flags kSerialBridgeToFd and/or kSerialBridgeFromFd, optionally kSerialBridgeCopyOnly.
+     * @return Bridge id (> 0), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialBridgeStart(int64_t handle, int fd, int flags, ErrorCallbackT error_callback = nullptr)
+        -> int64_t;
+
+    /**
+     * @brief Stop a bridge. Bytes it has read but not written yet are discarded. serialClose() stops the
+     * bridges of a handle as well.
+     *
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialBridgeStop(int64_t bridge, ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Read the counters of a running bridge.
+     *
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialBridgeStats(int64_t bridge, SerialBridgeStats *stats,
+                                      ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief Byte counters of the compressed-stream mode, as returned by serialGetCompressionStats().
+     *
+     * raw/wire is the compression ratio; at a fixed baud rate it is also the throughput gain.
+     */
+    struct SerialCompressionStats
+    {
+        uint64_t raw_tx_bytes;  ///< Bytes passed to serialWrite().
+        uint64_t wire_tx_bytes; ///< Bytes that went on the wire for them, framing included.
+        uint64_t raw_rx_bytes;  ///< Bytes returned by serialRead().
+        uint64_t wire_rx_bytes; ///< Bytes received from the wire.
+    };
+
+    /**
+     * @brief Turn the compressed-stream mode of a handle on or off.
+     *
+     * For slow links carrying compressible data, with this library on both ends. serialWrite() then sends LZ4-style
+     * compressed frames (each with a CRC) and serialRead() returns the decompressed bytes, so callers keep working
+     * with plain data. The dictionary is shared across writes, so even short, repetitive records shrink.
+     * serialRead()/serialWrite() (with their Ns and serialFast variants) and serialWriteAll() translate. Calls that
+     * work on the raw wire bytes (CRC frames, timestamped reads, serialReadAny(), serialTransact(), serialSubmit()
+     * and bridges) fail with kReadError/kWriteError while the mode is on. It cannot be enabled while write pacing or
+     * fan-out is on (kSetStateError), and those cannot be turned on while it is.
+     *
+     * Enabling (again) starts both directions with an empty dictionary. Enable both ends before any data flows.
+     * If a frame is lost or damaged, serialRead() fails with kReadError and both ends must re-enable the mode.
+     *
+     * @param enabled 1 to enable, 0 to disable.
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialSetCompression(int64_t handle, int enabled, ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Snapshot the byte counters of the compressed-stream mode since it was last enabled.
+     *
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialGetCompressionStats(int64_t handle, SerialCompressionStats *stats,
+                                              ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief Checksum algorithms supported by the CRC helpers.
+     *
+     * | Kind                | Parameters                                      | Trailer on the wire      |
+     * |---------------------|-------------------------------------------------|--------------------------|
+     * | kSerialCrc16Modbus  | reflected 0x8005, init 0xFFFF                   | 2 bytes, low byte first  |
+     * | kSerialCrc16Ccitt   | CRC-16/CCITT-FALSE: 0x1021, init 0xFFFF         | 2 bytes, high byte first |
+     * | kSerialCrc32        | ISO-HDLC (zlib), reflected, init/xorout ~0      | 4 bytes, low byte first  |
+     * | kSerialCrc32c       | Castagnoli, reflected, init/xorout ~0           | 4 bytes, low byte first  |
+     *
+     * CRC32 uses PCLMULQDQ folding and CRC32C the SSE4.2 crc32 instruction when the CPU supports them;
+     * otherwise slicing-by-8 tables are used. The kernel is chosen once at runtime.
+     */
+    enum SerialCrcKind
+    {
+        kSerialCrc16Modbus = 0,
+        kSerialCrc16Ccitt = 1,
+        kSerialCrc32 = 2,
+        kSerialCrc32c = 3,
+    };
+
+    /**
+     * @brief Compute a CRC over @p size bytes of @p data.
+     *
+     * @return The CRC value (>= 0), or a negative cpp_core::StatusCodes value for invalid arguments.
+     */
+    MODULE_API auto serialCrc(int crc_kind, const void *data, int size, ErrorCallbackT error_callback = nullptr)
+        -> int64_t;
+
+    /**
+     * @brief Write @p buffer followed by its CRC trailer, in a single writev() call.
+     *
+     * Behaves like serialWrite() otherwise (one retry after EAGAIN within @p timeout_ms, then tcdrain()).
+     *
+     * @return Bytes written including the trailer (buffer_size + 2 or + 4 when complete), 0 on timeout,
+     *         or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialWriteWithCrc(int64_t handle, const void *buffer, int buffer_size, int timeout_ms,
+                                       int multiplier, int crc_kind, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+    /**
+     * @brief Read like serialRead() and validate the CRC trailer of the received frame.
+     *
+     * Waits up to @p timeout_ms for the first byte, then collects bytes until the line has been quiet for
+     * 3.5 character times at the configured baud rate (at least 1.75 ms), or until @p buffer is full. What was
+     * collected is one frame (payload followed by trailer), as in Modbus RTU. A frame that fails validation is
+     * consumed all the same, so the next call starts at the next frame. The trailer stays in @p buffer right after
+     * the payload.
+     *
+     * @return Payload length (received bytes minus trailer), 0 on timeout, or a negative
+     *         cpp_core::StatusCodes value. A short frame or a CRC mismatch is reported as kReadError.
+     */
+    MODULE_API auto serialReadWithCrc(int64_t handle, void *buffer, int buffer_size, int timeout_ms, int multiplier,
+                                      int crc_kind, ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
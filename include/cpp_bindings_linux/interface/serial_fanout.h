@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /// What serialSetFanout() does when a subscriber falls a full buffer behind.
+    enum SerialFanoutPolicy
+    {
+        kSerialFanoutDrop = 0,  ///< Keep reading; a slow subscriber skips the oldest bytes (serialFanoutDropped()).
+        kSerialFanoutBlock = 1, ///< Stop reading the port until the slowest subscriber has made room.
+    };
+
+    /**
+     * @brief Turn multi-consumer read fan-out on or off for a handle.
+     *
+     * Only one caller can use serialRead() on a handle without taking bytes away from the others. In fan-out mode a
+     * background thread reads the port once into a shared buffer of @p buffer_capacity bytes instead, and every
+     * subscriber (serialFanoutSubscribe()) consumes the same stream through its own cursor, at its own pace, with
+     * serialFanoutRead(). Bytes that arrive while nobody is subscribed are discarded.
+     *
+     * While the mode is on, every other read of the handle (serialRead(), serialReadTimestamped(), serialReadAny(),
+     * serialReadWithCrc(), serialTransact(), the reads of serialSubmit()) fails with kReadError, and bridges do not
+     * forward from it. Disabling drops all subscribers and their unread bytes; enabling again starts over with a
+     * new, empty buffer.
+     *
+     * @param buffer_capacity Size of the shared buffer in bytes (1 .. 16 MiB), or 0 to disable.
+     * @param policy          A SerialFanoutPolicy value; ignored when disabling.
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialSetFanout(int64_t handle, int buffer_capacity, int policy,
+                                    ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Add a subscriber. Its cursor starts at the current end of the stream, so it sees new bytes only.
+     *
+     * @return Subscriber id (> 0), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialFanoutSubscribe(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int64_t;
+
+    /**
+     * @brief Remove a subscriber. With the block policy this may let the port be read again.
+     *
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialFanoutUnsubscribe(int64_t handle, int64_t subscriber,
+                                            ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Read the next bytes of the stream for one subscriber.
+     *
+     * Returns what is waiting for this subscriber, or waits at most @p timeout_ms for more. Several subscribers
+     * may read from different threads at the same time. A read error hit by the background thread (e.g. the
+     * device went away) is reported to every subscriber once it has consumed the bytes received before it. When
+     * serialEnableReconnect() reopens the device, the stream continues with the bytes of the new device.
+     *
+     * @return Bytes read (>= 0, 0 on timeout), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialFanoutRead(int64_t handle, int64_t subscriber, void *buffer, int buffer_size,
+                                     int timeout_ms, ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Number of bytes a subscriber has skipped so far because it fell behind (drop policy).
+     *
+     * @return Dropped byte count (>= 0), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialFanoutDropped(int64_t handle, int64_t subscriber,
+                                        ErrorCallbackT error_callback = nullptr) -> int64_t;
+
+} // extern "C"
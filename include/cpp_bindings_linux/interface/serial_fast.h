@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+/**
+ * Lean entry points for FFI runtimes with a fast call path (e.g. Deno/V8 fast API calls).
+ *
+ * They mirror serialOpen/serialClose/serialRead/serialWrite, but use 32-bit handles and no callback parameter:
+ * i64 results (BigInt in JavaScript) and function-pointer arguments force the slow call path. Failures are
+ * reported as a negative cpp_core::StatusCodes value, and the matching message is kept per thread for
+ * serialFastLastError(), in the manner of errno.
+ */
+extern "C"
+{
+    /** @brief Like serialOpen(); @p port is a null-terminated path. @return Handle (> 0) or a negative status. */
+    MODULE_API auto serialFastOpen(const char *port, int32_t baudrate, int32_t data_bits, int32_t parity,
+                                   int32_t stop_bits) -> int32_t;
+
+    /** @brief Like serialClose(). */
+    MODULE_API auto serialFastClose(int32_t handle) -> int32_t;
+
+    /** @brief Like serialRead(). */
+    MODULE_API auto serialFastRead(int32_t handle, void *buffer, int32_t buffer_size, int32_t timeout_ms) -> int32_t;
+
+    /** @brief Like serialWrite(). */
+    MODULE_API auto serialFastWrite(int32_t handle, const void *buffer, int32_t buffer_size, int32_t timeout_ms)
+        -> int32_t;
+
+    /**
+     * @brief Status and message of the most recent failed serialFast* call on the calling thread.
+     *
+     * Successful calls leave the stored error untouched.
+     *
+     * @param message      Optional output buffer; receives the null-terminated (possibly truncated) message.
+     * @param message_size Size of @p message in bytes.
+     * @return The stored status code (0 if no serialFast* call has failed on this thread yet).
+     */
+    MODULE_API auto serialFastLastError(char *message, int32_t message_size) -> int32_t;
+
+} // extern "C"
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /// Upper bound for the spin budget accepted by serialSetBusyPoll() (1 s).
+    inline constexpr int64_t kSerialBusyPollMaxNs = 1'000'000'000;
+
+    /**
+     * @brief Turn busy-poll reads on or off for a handle.
+     *
+     * Waking a thread that sleeps in poll() takes tens of microseconds, longer than a short frame at high baud
+     * rates. With a spin budget set, serialRead()/serialReadNs() first retry a non-blocking read() for up to
+     * @p spin_budget_ns (or the call's timeout, if shorter) and only then fall back to the blocking wait for the rest
+     * of the timeout. The calling thread keeps its core busy while spinning; pin it to a dedicated core.
+     * Reads with a zero timeout and reads in compressed-stream mode do not spin.
+     *
+     * @param spin_budget_ns Spin time per read in nanoseconds (0 .. kSerialBusyPollMaxNs); 0 disables busy-poll.
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialSetBusyPoll(int64_t handle, int64_t spin_budget_ns, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+    /**
+     * @brief CPU affinity and scheduling policy of the library's background threads.
+     *
+     * Applies to the reconnect supervisor (serialEnableReconnect()), the write pacer (serialSetWritePacing()), the
+     * fan-out reader (serialSetFanout()) and the bridge thread (serialBridgeStart()): at once to the threads that
+     * are running, and to every such thread started later.
+     *
+     * @param cpus      Array of @p cpu_count CPU numbers the threads may run on; null/0 allows every CPU.
+     * @param cpu_count Number of entries in @p cpus.
+     * @param policy    SCHED_OTHER, SCHED_BATCH, SCHED_IDLE, SCHED_FIFO or SCHED_RR (from <sched.h>).
+     * @param priority  Static priority for SCHED_FIFO/SCHED_RR (1..99); 0 for the other policies.
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value. kSetStateError when a running thread could
+     *         not be updated (real-time policies need CAP_SYS_NICE); the settings are kept for later threads.
+     */
+    MODULE_API auto serialSetThreadTuning(const int *cpus, int cpu_count, int policy, int priority,
+                                          ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cpp_core/interface/serial_open.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief One port to open with serialOpenBatch(). Same parameters as serialOpen().
+     *
+     * Layout is fixed (24 bytes, 8-byte aligned) so FFI callers can pass a plain byte buffer.
+     */
+    struct SerialOpenRequest
+    {
+        const char *port;  ///< Null-terminated device path.
+        int32_t baudrate;  ///< >= 300
+        int32_t data_bits; ///< 5-8
+        int32_t parity;    ///< 0 = none, 1 = even, 2 = odd
+        int32_t stop_bits; ///< 0/1 = one stop bit, 2 = two stop bits
+    };
+
+    /// Upper bound for the number of worker threads used by one serialOpenBatch() call.
+    inline constexpr int kSerialOpenBatchMaxThreads = 64;
+
+    /**
+     * @brief Open and configure many ports concurrently.
+     *
+     * Each port still costs open + TCGETS2 + TCSETS2 + tcflush, which USB-serial drivers can stretch to several
+     * milliseconds; spreading them over a small pool makes fleet startup take about as long as the slowest port
+     * instead of the sum of all of them.
+     *
+     * @param requests    Array of @p count ports to open.
+     * @param handles     Output array of @p count entries: handles[i] receives the handle for requests[i], or the
+     *                    negative cpp_core::StatusCodes value serialOpen() would have returned for it.
+     * @param count       Number of requests (>= 0).
+     * @param max_threads Upper bound for concurrently opening threads including the caller (<= 0 picks the
+     *                    default of 16; capped at kSerialOpenBatchMaxThreads).
+     * @param error_callback Optional callback, invoked on the calling thread once per failed port after all
+     *                    workers have finished (never from a worker thread).
+     * @return Number of ports opened successfully, or a negative cpp_core::StatusCodes value for invalid arguments
+     *         (in which case nothing was opened).
+     */
+    MODULE_API auto serialOpenBatch(const SerialOpenRequest *requests, int64_t *handles, int count, int max_threads,
+                                    ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief Number of received bytes waiting in the kernel input queue (TIOCINQ).
+     *
+     * Lets callers size read buffers to what is actually there instead of over-allocating.
+     *
+     * @return Queued byte count (>= 0), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialInputQueueDepth(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Number of bytes written but not yet transmitted, still in the kernel output queue (TIOCOUTQ).
+     *
+     * @return Queued byte count (>= 0), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialOutputQueueDepth(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Configure the output low-water mark used by serialWaitOutputLowWater().
+     *
+     * @param handle    Handle returned by serialOpen().
+     * @param low_water Threshold in bytes (>= 0). The default is 0, i.e. "output queue empty".
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialSetOutputLowWater(int64_t handle, int low_water, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+    /**
+     * @brief Block until the output queue has drained to the low-water mark, or until @p timeout_ms passes.
+     *
+     * Use it as a backpressure signal: write the next block only once this returns 1, so the kernel never
+     * holds more than the low-water mark plus one block. The wait sleeps for the time the UART needs to send
+     * the excess at the configured baud rate and re-checks, so it does not busy-wait.
+     *
+     * @return 1 when the queue is at or below the mark, 0 on timeout, or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialWaitOutputLowWater(int64_t handle, int timeout_ms, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+} // extern "C"
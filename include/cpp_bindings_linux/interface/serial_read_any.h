@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief One entry of the result list produced by serialReadAny().
+     *
+     * Layout is fixed (16 bytes, 8-byte aligned) so FFI callers can pass a plain byte buffer.
+     */
+    struct SerialReadAnyResult
+    {
+        int64_t handle;     ///< Handle that delivered data (or failed).
+        int32_t bytes_read; ///< Bytes stored in the buffer of that handle, or a negative cpp_core::StatusCodes value.
+        int32_t index;      ///< Position of @ref handle in the input arrays.
+    };
+
+    /// Upper bound for the number of handles accepted by a single serialReadAny() call.
+    inline constexpr int kSerialReadAnyMaxHandles = 1024;
+
+    /**
+     * @brief Wait once until any of the given handles is readable and read from every ready handle.
+     *
+     * A single poll() covers all handles. Every handle that is readable afterwards gets exactly one
+     * non-blocking read into its own buffer, so one call replaces a poll+read round trip per port.
+     *
+     * @param handles       Array of @p count handles returned by serialOpen().
+     * @param buffers       Array of @p count caller buffers, buffers[i] belongs to handles[i].
+     * @param buffer_sizes  Array of @p count buffer sizes (each > 0).
+     * @param count         Number of handles (1..kSerialReadAnyMaxHandles).
+     * @param results       Output array with room for @p count entries. Only handles that delivered data
+     *                      (or failed) get an entry, in input order.
+     * @param timeout_ms    Maximum time to wait for the first handle to become readable (negative = 0).
+     * @param error_callback Optional callback, invoked for argument errors and for every handle that failed.
+     * @return Number of entries written to @p results (0 on timeout), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialReadAny(const int64_t *handles, void *const *buffers, const int *buffer_sizes, int count,
+                                  SerialReadAnyResult *results, int timeout_ms,
+                                  ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
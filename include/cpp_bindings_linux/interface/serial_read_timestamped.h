@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief Receive timestamp of the data returned by serialReadTimestamped().
+     *
+     * Layout is fixed (16 bytes, 8-byte aligned) so FFI callers can pass a plain byte buffer.
+     */
+    struct SerialRxTimestamp
+    {
+        int32_t offset;       ///< Offset of the data inside the read buffer (always 0).
+        int32_t length;       ///< Number of bytes the record covers.
+        int64_t monotonic_ns; ///< CLOCK_MONOTONIC time of the readiness wakeup that preceded the data.
+    };
+
+    /**
+     * @brief Read like serialRead() and report when the data became readable.
+     *
+     * A call performs a single read(), like serialRead(), so it produces one record covering all bytes returned
+     * (none on timeout or error). The timestamp is taken right after the readiness wait returned, so it reflects
+     * arrival time rather than the time the caller got around to reading. Bytes that were already queued together
+     * share that one timestamp; call again for finer-grained arrival times.
+     *
+     * @param handle             Handle returned by serialOpen().
+     * @param buffer             Destination buffer.
+     * @param buffer_size        Size of @p buffer in bytes (> 0).
+     * @param timeout_ms         Maximum time to wait for the first byte (negative = 0).
+     * @param multiplier         Unused, kept for signature parity with serialRead().
+     * @param timestamps         Output array for the timestamp record.
+     * @param timestamp_capacity Number of entries @p timestamps can hold (> 0); only the first is used.
+     * @param timestamp_count    Receives the number of records written (0 on timeout or error).
+     * @param error_callback     Optional error callback.
+     * @return Number of bytes read, 0 on timeout, or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialReadTimestamped(int64_t handle, void *buffer, int buffer_size, int timeout_ms,
+                                          int multiplier, SerialRxTimestamp *timestamps, int timestamp_capacity,
+                                          int *timestamp_count, ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cpp_core/interface/serial_open.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief Reopen @p handle automatically when its device disconnects and comes back.
+     *
+     * A background thread waits for the hangup and then for the device node to reappear (inotify, no polling),
+     * reopens it with the settings the handle was opened with and puts it in place under the same handle. Until
+     * then reads and writes fail with kReadError/kWriteError ("No such device") instead of blocking or returning 0.
+     *
+     * @param handle            Handle returned by serialOpen().
+     * @param usb_serial_number Optional USB serial number. When set, the device is found again through
+     *                          /dev/serial/by-id, so it may come back under a different /dev/ttyUSB* name.
+     *                          When null or empty, it must reappear at the path it was opened with.
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialEnableReconnect(int64_t handle, const char *usb_serial_number = nullptr,
+                                          ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Stop reopening @p handle. serialClose() does this implicitly.
+     *
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialDisableReconnect(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Whether the device behind @p handle is attached. Does not block.
+     *
+     * @return 1 when connected, 0 after a hangup (until a reconnect), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialIsConnected(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
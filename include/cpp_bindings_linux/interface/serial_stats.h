@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief Traffic counters of one handle, as returned by serialGetStats().
+     *
+     * Read-side and write-side counters are kept separately, so collecting them never slows down the other
+     * direction. The values are totals since serialOpen().
+     */
+    struct SerialPortStats
+    {
+        uint64_t rx_bytes;    ///< Bytes returned by read-side calls.
+        uint64_t tx_bytes;    ///< Bytes accepted by write-side calls.
+        uint64_t read_calls;  ///< Completed read-side calls (including timeouts).
+        uint64_t write_calls; ///< Completed write-side calls.
+    };
+
+    /**
+     * @brief Snapshot the traffic counters of a handle opened with serialOpen().
+     *
+     * The counters are atomics, so this never waits for a read or write in progress on the handle.
+     *
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialGetStats(int64_t handle, SerialPortStats *stats, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+} // extern "C"
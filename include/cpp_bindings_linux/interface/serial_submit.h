@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /// Operation kinds for SerialOperation::op.
+    enum SerialOperationKind
+    {
+        kSerialOperationRead = 0,
+        kSerialOperationWrite = 1,
+    };
+
+    /**
+     * @brief One read or write submitted through serialSubmit().
+     *
+     * Layout is fixed (32 bytes, 8-byte aligned) so FFI callers can pass a plain byte buffer.
+     */
+    struct SerialOperation
+    {
+        int64_t handle;      ///< Handle returned by serialOpen().
+        int32_t op;          ///< SerialOperationKind
+        int32_t buffer_size; ///< > 0
+        void *buffer;        ///< Destination (read) or source (write) of buffer_size bytes.
+        int32_t timeout_ms;  ///< Per-operation timeout, measured from the start of the serialSubmit() call.
+        int32_t reserved;    ///< Must be 0.
+    };
+
+    /// Upper bound for the number of operations accepted by a single serialSubmit() call.
+    inline constexpr int kSerialSubmitMaxOperations = 256;
+
+    /**
+     * @brief Execute a batch of reads and writes in one call, overlapping the waits of all handles.
+     *
+     * Every operation first gets a non-blocking attempt; whatever is left then waits in one shared poll() until
+     * it can make progress or its own timeout passes. Operations on the same handle and direction run in array
+     * order; everything else proceeds concurrently, so a request written to one port and the response read from
+     * another (or the same) port complete in one native call.
+     *
+     * - A read behaves like serialRead(): it completes with the first data that arrives (0 on timeout).
+     * - A write behaves like serialWriteAll(): it completes once all bytes are queued (short on timeout). It does
+     *   not drain the output queue, which would stall every other operation in the batch.
+     *
+     * The per-handle side locks are held for the whole call, taken in a fixed order.
+     *
+     * @param operations Array of @p count operation descriptors.
+     * @param results    Output array of @p count entries: bytes transferred, or a negative cpp_core::StatusCodes
+     *                   value for an operation that failed.
+     * @param count      Number of operations (1..kSerialSubmitMaxOperations).
+     * @param error_callback Optional callback, invoked for argument errors and once per failed operation.
+     * @return Number of operations that did not fail, or a negative cpp_core::StatusCodes value for invalid
+     *         arguments (in which case nothing was executed).
+     */
+    MODULE_API auto serialSubmit(const SerialOperation *operations, int32_t *results, int count,
+                                 ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief serialRead() with a timeout in nanoseconds.
+     *
+     * poll() counts in whole milliseconds, which at 3 Mbaud is several frames. This variant waits with ppoll(),
+     * measured on CLOCK_MONOTONIC, so a 200 µs timeout is 200 µs. Everything else (locking, compressed-stream mode,
+     * hangup reporting, statistics) is exactly as in serialRead().
+     *
+     * @param timeout_ns Maximum wait for the first byte; <= 0 only returns what is already queued.
+     * @return Bytes read (0 on timeout), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialReadNs(int64_t handle, void *buffer, int buffer_size, int64_t timeout_ns,
+                                 ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief serialWrite() with a timeout in nanoseconds (see serialReadNs()).
+     *
+     * @param timeout_ns Maximum wait for room in the output queue.
+     * @return Bytes written (0 on timeout), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialWriteNs(int64_t handle, const void *buffer, int buffer_size, int64_t timeout_ns,
+                                  ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /// Flags for serialTransact().
+    enum SerialTransactFlags
+    {
+        kSerialTransactFlushInput = 1, ///< Discard stale received bytes (TCIFLUSH, and kept ones) first.
+    };
+
+    /**
+     * @brief One request/response exchange for serialTransact().
+     *
+     * A reply is complete at the first of: @p reply_length bytes, the @p delimiter byte (kept in the reply),
+     * a pause of @p inter_byte_timeout_ms after its last byte, or @p reply_capacity bytes.
+     *
+     * Layout is fixed (40 bytes, 8-byte aligned) so FFI callers can pass a plain byte buffer.
+     */
+    struct SerialTransaction
+    {
+        const void *request;           ///< Bytes to send; may be null when request_size is 0 (read only).
+        void *reply;                   ///< Destination of the reply, reply_capacity bytes.
+        int32_t request_size;          ///< >= 0
+        int32_t reply_capacity;        ///< > 0
+        int32_t reply_length;          ///< Fixed reply length (1..reply_capacity), or 0 for none.
+        int32_t delimiter;             ///< Terminating byte (0..255), or -1 for none.
+        int32_t inter_byte_timeout_ms; ///< Gap that ends a started reply (> 0), or 0 for none.
+        int32_t reply_size;            ///< Output: bytes stored in reply (also for an incomplete reply).
+    };
+
+    /// Upper bound for the number of transactions accepted by a single serialTransact() call.
+    inline constexpr int kSerialTransactMaxTransactions = 256;
+
+    /**
+     * @brief Write requests and read their replies in one call, under one deadline.
+     *
+     * Replaces serialWrite() + tcdrain + a serialRead() loop per command: requests are written non-blocking and
+     * the replies are collected from the same poll() loop, without draining the output queue in between.
+     *
+     * With @p pipeline_depth > 1, up to that many requests are on the wire before the oldest reply is complete,
+     * so a device that queues commands answers them back to back instead of one round trip each. Replies are
+     * matched to requests in order. Use 1 for devices that accept one command at a time.
+     *
+     * Both sides of the handle are locked for the whole call. Like the other extended calls it works on the raw
+     * wire bytes: paced writes are bypassed, and a handle in compressed-stream mode is refused with kWriteError.
+     * Bytes received after the last reply are kept with the handle and returned first by the next read-side call
+     * (serialRead(), serialReadWithCrc(), serialSubmit(), another serialTransact(), ...), so nothing the device
+     * sends afterwards is lost. kSerialTransactFlushInput and switching to fan-out mode discard them. Descriptors
+     * not opened with serialOpen() have nowhere to keep them: there a delimited last reply is read one byte per
+     * syscall instead.
+     *
+     * @param transactions   Array of @p count transactions, completed in order.
+     * @param count          Number of transactions (1..kSerialTransactMaxTransactions).
+     * @param pipeline_depth Maximum number of requests sent ahead of their reply (>= 1).
+     * @param flags          Bitwise OR of SerialTransactFlags.
+     * @param timeout_ms     Deadline for the whole call.
+     * @return Number of transactions whose reply is complete (less than @p count on timeout), or a negative
+     *         cpp_core::StatusCodes value. Every reply_size is filled in either way.
+     */
+    MODULE_API auto serialTransact(int64_t handle, SerialTransaction *transactions, int count, int pipeline_depth,
+                                   int flags, int timeout_ms, ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
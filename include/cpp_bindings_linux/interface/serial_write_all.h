@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cpp_core/interface/serial_write.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /**
+     * @brief Write the whole buffer, looping over partial writes until done or until one overall deadline expires.
+     *
+     * Unlike serialWrite(), which retries at most once after EAGAIN and may return a short count, this keeps
+     * calling write() and waits for POLLOUT between chunks, all within a single @p timeout_ms budget. It returns
+     * as soon as the kernel has accepted every byte; it does not wait for transmission (no tcdrain()).
+     *
+     * @param handle         Handle returned by serialOpen().
+     * @param buffer         Data to write.
+     * @param buffer_size    Number of bytes to write (> 0).
+     * @param timeout_ms     Overall deadline for the whole buffer (negative = 0, i.e. only what fits right now).
+     * @param multiplier     Unused, kept for signature parity with serialWrite().
+     * @param error_callback Optional error callback.
+     * @return @p buffer_size on success. On timeout, the number of bytes accepted so far (0..buffer_size-1).
+     *         A negative cpp_core::StatusCodes value on error.
+     */
+    MODULE_API auto serialWriteAll(int64_t handle, const void *buffer, int buffer_size, int timeout_ms,
+                                   int multiplier, ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
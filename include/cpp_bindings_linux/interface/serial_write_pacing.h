@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cpp_core/interface/serial_read.h>
+
+#include <cstdint>
+
+extern "C"
+{
+    /// Priority classes for serialWritePriority() and serialGetWriteLaneStats().
+    enum SerialWriteLane
+    {
+        kSerialWriteLaneBulk = 0,   ///< Same queue as serialWritePaced().
+        kSerialWriteLaneUrgent = 1, ///< Sent at the next bulk frame boundary, ahead of queued bulk data.
+    };
+
+    /// Capacity of the urgent lane, and so the largest urgent frame, in bytes.
+    inline constexpr int kSerialUrgentFrameMax = 4096;
+
+    /**
+     * @brief Queueing delay counters of one lane (serialGetWriteLaneStats()).
+     *
+     * The queueing delay of a frame runs from the call that queued it to the moment its last byte was handed to
+     * the kernel. Layout is fixed (48 bytes, 8-byte aligned) so FFI callers can pass a plain byte buffer.
+     */
+    struct SerialWriteLaneStats
+    {
+        uint64_t frames_sent;   ///< Frames handed to the kernel completely.
+        uint64_t bytes_sent;    ///< Bytes handed to the kernel.
+        int64_t total_delay_ns; ///< Sum of the queueing delays; divide by frames_sent for the mean.
+        int64_t max_delay_ns;   ///< Longest queueing delay.
+        int64_t last_delay_ns;  ///< Queueing delay of the most recent frame.
+        uint32_t queued_frames; ///< Frames still waiting, including one in transmission.
+        uint32_t queued_bytes;  ///< Bytes still waiting.
+    };
+
+    /**
+     * @brief Turn baud-aware write pacing on or off for a handle.
+     *
+     * Writing a large block with serialWrite() parks all of it in the kernel output queue; at low baud rates that
+     * is seconds of data, and a short command written after it waits for all of it. With pacing on, bulk data goes
+     * through serialWritePaced() instead: it is queued in a userspace buffer and a background thread hands it to
+     * the kernel in slices, keeping at most @p max_queued_ms worth of wire time (at the configured baud rate) in the
+     * kernel queue. A serialWrite() issued meanwhile therefore goes out after at most that much bulk data.
+     *
+     * The kernel queue is estimated from TIOCOUTQ and from the bytes handed over so far at the baud rate, whichever
+     * is larger, so adapters that report bytes as sent once they reached the USB stack are paced too.
+     *
+     * Disabling discards queued data that has not been handed to the kernel yet. Enabling (again) starts with
+     * empty queues and zeroed lane statistics.
+     *
+     * @param max_queued_ms  Bound on the kernel output queue in milliseconds of wire time (> 0), or 0 to disable.
+     * @param queue_capacity Size of the userspace buffer in bytes (1 .. 16 MiB); ignored when disabling.
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialSetWritePacing(int64_t handle, int max_queued_ms, int queue_capacity,
+                                         ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Queue bulk data for paced transmission (see serialSetWritePacing()).
+     *
+     * Returns as soon as the data is in the userspace buffer; waits at most @p timeout_ms for room when it is full.
+     * A write error hit by the background thread is reported here, by the next call, and drops the queued data.
+     *
+     * The bytes of one call form one frame (see serialWritePriority()); a frame queued by another thread waits
+     * until this call has returned.
+     *
+     * @return Bytes queued (>= 0, less than @p buffer_size on timeout), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialWritePaced(int64_t handle, const void *buffer, int buffer_size, int timeout_ms,
+                                     ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Queue a frame in one of the priority lanes of a paced handle.
+     *
+     * The kernel sends its output queue strictly in order, so an emergency stop or a heartbeat written behind a
+     * firmware upload waits for all of it. In paced mode only a bounded amount of bulk data sits in the kernel,
+     * and an urgent frame skips the rest: the background thread hands it over as soon as the bulk frame it is
+     * transmitting has ended, without waiting for room under the pacing bound. Frames never interleave on the
+     * wire. Bulk frames are the bytes of one call, so a large transfer queued in protocol-sized frames lets urgent
+     * frames through sooner than one queued with a single call.
+     *
+     * Urgent frames are queued whole or not at all: the call waits at most @p timeout_ms for room and returns 0 if
+     * none became free. Bulk frames behave like serialWritePaced().
+     *
+     * @param lane        kSerialWriteLaneBulk or kSerialWriteLaneUrgent.
+     * @param buffer_size Frame size (> 0; at most kSerialUrgentFrameMax for the urgent lane).
+     * @return Bytes queued (@p buffer_size, less on timeout), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialWritePriority(int64_t handle, const void *buffer, int buffer_size, int lane, int timeout_ms,
+                                        ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Read the queueing delay counters of one lane since pacing was enabled.
+     *
+     * @return 0 (kSuccess) or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialGetWriteLaneStats(int64_t handle, int lane, SerialWriteLaneStats *stats,
+                                            ErrorCallbackT error_callback = nullptr) -> int;
+
+    /**
+     * @brief Number of bytes queued in either lane that have not been handed to the kernel yet.
+     *
+     * @return Queued byte count (>= 0), or a negative cpp_core::StatusCodes value.
+     */
+    MODULE_API auto serialPacedQueueDepth(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int;
+
+} // extern "C"
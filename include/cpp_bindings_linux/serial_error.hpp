@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cpp_core/status_codes.h>
+
+#include <cerrno>
+#include <expected>
+#include <string>
+#include <system_error>
+
+namespace cpp_bindings_linux
+{
+/**
+ * @brief Failure reported by the C++ API.
+ *
+ * Validation failures carry a static @c message. OS failures carry the @c error_number (errno) of the failed
+ * syscall and leave @c message null. Copying is free, and building the error allocates nothing.
+ */
+struct SerialError
+{
+    cpp_core::StatusCodes code = cpp_core::StatusCodes::kSuccess;
+    int error_number = 0;
+    const char *message = nullptr;
+
+    /** @brief The device went away (hangup, e.g. an unplugged USB adapter) rather than failing in place. */
+    [[nodiscard]] auto disconnected() const noexcept -> bool
+    {
+        return error_number == ENODEV;
+    }
+
+    /** @brief Human-readable description: the static message, or the strerror text of @c error_number. */
+    [[nodiscard]] auto what() const -> std::string
+    {
+        return message != nullptr ? std::string(message)
+                                  : std::error_code(error_number, std::generic_category()).message();
+    }
+};
+
+template <typename T> using SerialResult = std::expected<T, SerialError>;
+
+} // namespace cpp_bindings_linux
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cpp_bindings_linux/detail/unique_fd.hpp>
+#include <cpp_bindings_linux/serial_error.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace cpp_bindings_linux
+{
+enum class Parity
+{
+    kNone = 0,
+    kEven = 1,
+    kOdd = 2,
+};
+
+/** @brief Line settings applied by SerialPort::open(). Same ranges as serialOpen(). */
+struct SerialOptions
+{
+    int baudrate = 115200;
+    int data_bits = 8;
+    Parity parity = Parity::kNone;
+    int stop_bits = 1;
+};
+
+/**
+ * @brief Non-owning reference to an open port.
+ *
+ * Carries only the file descriptor, so it is as cheap to pass around as an int. The C ABI is implemented on top of
+ * this type; it adds handle validation, per-handle locking and statistics around each call.
+ */
+class SerialPortView
+{
+  public:
+    explicit SerialPortView(int native_handle) noexcept : fd_(native_handle)
+    {
+    }
+
+    [[nodiscard]] auto nativeHandle() const noexcept -> int
+    {
+        return fd_;
+    }
+
+    /**
+     * @brief Read whatever is available, waiting at most @p timeout for the first byte.
+     *
+     * Performs at most one read(): a zero timeout asks the kernel how much is queued instead of polling.
+     * The timeout has nanosecond resolution (ppoll()), so sub-millisecond waits are honoured as given.
+     *
+     * @return Bytes read (0 on timeout), or the error. A device that hung up is an error for which
+     *         SerialError::disconnected() is true, never a 0-byte timeout.
+     */
+    [[nodiscard]] auto read(std::span<std::byte> buffer, std::chrono::nanoseconds timeout) const
+        -> SerialResult<std::size_t>;
+
+    /**
+     * @brief Write @p data, waiting at most @p timeout for room in the output queue, then drain it (tcdrain).
+     *
+     * @return Bytes accepted by the kernel (0 on timeout; may be short), or the error.
+     */
+    [[nodiscard]] auto write(std::span<const std::byte> data, std::chrono::nanoseconds timeout) const
+        -> SerialResult<std::size_t>;
+
+  private:
+    int fd_;
+};
+
+/**
+ * @brief Owning serial port (RAII): the descriptor is closed when the object goes out of scope.
+ *
+ * Move-only. One thread may read while another writes; several threads on the same direction must synchronize
+ * themselves (the C ABI does that with per-handle locks).
+ */
+class SerialPort
+{
+  public:
+    SerialPort() = default;
+
+    /** @brief Open @p path in raw mode with the given line settings. */
+    [[nodiscard]] static auto open(const std::string &path, const SerialOptions &options) -> SerialResult<SerialPort>;
+
+    /** @brief Take ownership of a descriptor obtained elsewhere (e.g. a handle returned by serialOpen()). */
+    [[nodiscard]] static auto adopt(int native_handle) noexcept -> SerialPort
+    {
+        return SerialPort(detail::UniqueFd(native_handle));
+    }
+
+    [[nodiscard]] auto valid() const noexcept -> bool
+    {
+        return fd_.valid();
+    }
+
+    [[nodiscard]] auto nativeHandle() const noexcept -> int
+    {
+        return fd_.get();
+    }
+
+    [[nodiscard]] auto view() const noexcept -> SerialPortView
+    {
+        return SerialPortView(fd_.get());
+    }
+
+    [[nodiscard]] auto read(std::span<std::byte> buffer, std::chrono::nanoseconds timeout) const
+        -> SerialResult<std::size_t>
+    {
+        return view().read(buffer, timeout);
+    }
+
+    [[nodiscard]] auto write(std::span<const std::byte> data, std::chrono::nanoseconds timeout) const
+        -> SerialResult<std::size_t>
+    {
+        return view().write(data, timeout);
+    }
+
+    /** @brief Close now and report the result (the destructor closes silently). No-op when not valid(). */
+    auto close() -> SerialResult<void>;
+
+    /** @brief Give up ownership; the caller becomes responsible for closing the returned descriptor. */
+    [[nodiscard]] auto release() noexcept -> int
+    {
+        return fd_.release();
+    }
+
+  private:
+    explicit SerialPort(detail::UniqueFd handle) noexcept : fd_(std::move(handle))
+    {
+    }
+
+    detail::UniqueFd fd_;
+};
+
+} // namespace cpp_bindings_linux
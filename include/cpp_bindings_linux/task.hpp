@@ -0,0 +1,172 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace cpp_bindings_linux
+{
+template <typename T> class Task;
+
+namespace detail
+{
+// Resumes whoever awaited the task once it finishes (symmetric transfer, so deep await chains do not grow the
+// stack). Detached tasks have no continuation and simply stop at their final suspend point.
+struct TaskFinalAwaiter
+{
+    [[nodiscard]] auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    template <typename Promise>
+    auto await_suspend(std::coroutine_handle<Promise> handle) const noexcept -> std::coroutine_handle<>
+    {
+        const auto continuation = handle.promise().continuation;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+
+    auto await_resume() const noexcept -> void
+    {
+    }
+};
+
+struct TaskPromiseBase
+{
+    std::coroutine_handle<> continuation;
+
+    [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always
+    {
+        return {};
+    }
+
+    [[nodiscard]] auto final_suspend() const noexcept -> TaskFinalAwaiter
+    {
+        return {};
+    }
+
+    // The library reports failures through SerialResult and never throws out of a coroutine.
+    [[noreturn]] auto unhandled_exception() const noexcept -> void
+    {
+        std::terminate();
+    }
+};
+
+template <typename T> struct TaskPromise : TaskPromiseBase
+{
+    std::optional<T> value;
+
+    auto get_return_object() -> Task<T>;
+
+    template <typename U> auto return_value(U &&result) -> void
+    {
+        value.emplace(std::forward<U>(result));
+    }
+};
+
+template <> struct TaskPromise<void> : TaskPromiseBase
+{
+    auto get_return_object() -> Task<void>;
+
+    auto return_void() const noexcept -> void
+    {
+    }
+};
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine returning @p T.
+ *
+ * Nothing runs until the task is awaited (or handed to EventLoop::spawn()). The frame is owned by the Task object
+ * and destroyed with it.
+ */
+template <typename T> class [[nodiscard]] Task
+{
+  public:
+    using promise_type = detail::TaskPromise<T>;
+
+    Task() = default;
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle)
+    {
+    }
+
+    Task(const Task &) = delete;
+    auto operator=(const Task &) -> Task & = delete;
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {}))
+    {
+    }
+    auto operator=(Task &&other) noexcept -> Task &
+    {
+        if (this != &other)
+        {
+            reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        reset();
+    }
+
+    [[nodiscard]] auto done() const noexcept -> bool
+    {
+        return !handle_ || handle_.done();
+    }
+
+    [[nodiscard]] auto await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    auto await_suspend(std::coroutine_handle<> awaiting) noexcept -> std::coroutine_handle<>
+    {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+
+    auto await_resume() -> T
+    {
+        if constexpr (!std::is_void_v<T>)
+        {
+            return std::move(*handle_.promise().value);
+        }
+    }
+
+    // Starts a task that nobody awaits; used by EventLoop::spawn().
+    auto start() const -> void
+    {
+        handle_.resume();
+    }
+
+  private:
+    auto reset() noexcept -> void
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+            handle_ = {};
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail
+{
+template <typename T> auto TaskPromise<T>::get_return_object() -> Task<T>
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline auto TaskPromise<void>::get_return_object() -> Task<void>
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+} // namespace detail
+
+} // namespace cpp_bindings_linux
@@ -23,6 +23,50 @@ const symbols = {
         parameters: ["i64", "pointer", "i32", "i32", "i32", "pointer"] as const,
         result: "i32" as const,
     },
+    // Fast-call entry points: i32 handles, buffer arguments, no callback (see serial_fast.h)
+    serialFastOpen: {
+        parameters: ["buffer", "i32", "i32", "i32", "i32"] as const,
+        result: "i32" as const,
+    },
+    serialFastClose: {
+        parameters: ["i32"] as const,
+        result: "i32" as const,
+    },
+    serialFastRead: {
+        parameters: ["i32", "buffer", "i32", "i32"] as const,
+        result: "i32" as const,
+    },
+    serialFastWrite: {
+        parameters: ["i32", "buffer", "i32", "i32"] as const,
+        result: "i32" as const,
+    },
+    serialFastLastError: {
+        parameters: ["buffer", "i32"] as const,
+        result: "i32" as const,
+    },
+    // Nonblocking variants used by the streams layer (jsr/src/streams)
+    serialFastReadAsync: {
+        name: "serialFastRead",
+        parameters: ["i32", "buffer", "i32", "i32"] as const,
+        result: "i32" as const,
+        nonblocking: true,
+    },
+    serialWriteAllAsync: {
+        name: "serialWriteAll",
+        parameters: ["i64", "buffer", "i32", "i32", "i32", "pointer"] as const,
+        result: "i32" as const,
+        nonblocking: true,
+    },
+    serialWaitOutputLowWaterAsync: {
+        name: "serialWaitOutputLowWater",
+        parameters: ["i64", "i32", "pointer"] as const,
+        result: "i32" as const,
+        nonblocking: true,
+    },
+    serialSetOutputLowWater: {
+        parameters: ["i64", "i32", "pointer"] as const,
+        result: "i32" as const,
+    },
 };
 
 /**
@@ -0,0 +1,52 @@
+/**
+ * Per-call FFI overhead of the cpp-core ABI (i64 handle + callback pointer) versus the serialFast* entry points
+ * (i32 handle, no callback).
+ *
+ * Both variants are called with an invalid handle, so the native side returns after the same argument check and
+ * the measured difference is the cost of crossing the FFI boundary.
+ *
+ * Run with: deno task bench
+ */
+
+import { loadSerialLib } from "./ffi_bindings.ts";
+
+const lib = (await loadSerialLib()).symbols;
+
+const buffer = new Uint8Array(64);
+const bufferPointer = Deno.UnsafePointer.of(buffer);
+const invalidHandle64 = -1n;
+const invalidHandle32 = -1;
+
+Deno.bench({
+    name: "serialRead (i64 handle, pointer buffer, callback parameter)",
+    group: "read",
+    baseline: true,
+    fn() {
+        lib.serialRead(invalidHandle64, bufferPointer, buffer.length, 0, 0, null);
+    },
+});
+
+Deno.bench({
+    name: "serialFastRead (i32 handle, buffer, no callback)",
+    group: "read",
+    fn() {
+        lib.serialFastRead(invalidHandle32, buffer, buffer.length, 0);
+    },
+});
+
+Deno.bench({
+    name: "serialWrite (i64 handle, pointer buffer, callback parameter)",
+    group: "write",
+    baseline: true,
+    fn() {
+        lib.serialWrite(invalidHandle64, bufferPointer, buffer.length, 0, 0, null);
+    },
+});
+
+Deno.bench({
+    name: "serialFastWrite (i32 handle, buffer, no callback)",
+    group: "write",
+    fn() {
+        lib.serialFastWrite(invalidHandle32, buffer, buffer.length, 0);
+    },
+});
@@ -23,6 +23,15 @@ Deno.test({
         assertExists(lib.serialClose);
         assertExists(lib.serialRead);
         assertExists(lib.serialWrite);
+        assertExists(lib.serialFastOpen);
+        assertExists(lib.serialFastClose);
+        assertExists(lib.serialFastRead);
+        assertExists(lib.serialFastWrite);
+        assertExists(lib.serialFastLastError);
+        assertExists(lib.serialFastReadAsync);
+        assertExists(lib.serialWriteAllAsync);
+        assertExists(lib.serialWaitOutputLowWaterAsync);
+        assertExists(lib.serialSetOutputLowWater);
 
         console.log("cpp-bindings-linux library loaded and symbols resolved");
     },
@@ -0,0 +1,172 @@
+/**
+ * Throughput and per-chunk overhead of the streams layer (jsr/src/streams) versus a naive serialRead loop.
+ *
+ * The port is the slave side of a pseudo-terminal; the benchmark plays the device on the master side through libc.
+ *
+ * - "throughput": every iteration moves 1 MiB from the device to the caller, so iter/s reads as MiB/s. The naive
+ *   loop calls serialRead synchronously and copies each result into a fresh array, as a hand-written FFI loop
+ *   usually does; the stream reads with a BYOB reader into one reused 64 KiB buffer.
+ * - "read chunk" / "write chunk": one 64-byte chunk per iteration, so the time per iteration is the fixed cost of
+ *   a chunk on each path.
+ *
+ * Run with: deno task bench
+ */
+
+import { serialReadable, serialWritable } from "../jsr/src/streams/index.ts";
+import { loadSerialLib } from "./ffi_bindings.ts";
+
+const lib = (await loadSerialLib()).symbols;
+
+const libc = Deno.dlopen("libc.so.6", {
+    posix_openpt: { parameters: ["i32"] as const, result: "i32" as const },
+    grantpt: { parameters: ["i32"] as const, result: "i32" as const },
+    unlockpt: { parameters: ["i32"] as const, result: "i32" as const },
+    ptsname_r: { parameters: ["i32", "buffer", "usize"] as const, result: "i32" as const },
+    read: { parameters: ["i32", "buffer", "usize"] as const, result: "isize" as const },
+    write: { parameters: ["i32", "buffer", "usize"] as const, result: "isize" as const },
+    writeAsync: {
+        name: "write",
+        parameters: ["i32", "buffer", "usize"] as const,
+        result: "isize" as const,
+        nonblocking: true,
+    },
+}).symbols;
+
+const O_RDWR = 2;
+const O_NOCTTY = 0o400;
+
+const master = libc.posix_openpt(O_RDWR | O_NOCTTY);
+if (master < 0 || libc.grantpt(master) !== 0 || libc.unlockpt(master) !== 0) {
+    throw new Error("No pseudo-terminal available");
+}
+const slaveName = new Uint8Array(64);
+libc.ptsname_r(master, slaveName, BigInt(slaveName.length));
+const handle = lib.serialFastOpen(slaveName, 115200, 8, 0, 1);
+if (handle < 0) {
+    throw new Error(`serialFastOpen failed with status ${handle}`);
+}
+const handle64 = BigInt(handle);
+
+const kMiB = 1024 * 1024;
+const payload = new Uint8Array(kMiB).map((_, i) => i & 0xff);
+const chunk = payload.subarray(0, 64);
+
+// Writes from a worker thread, so it can run while the main thread is blocked in a synchronous read. A blocking
+// write() to a pty master returns once everything is queued, so the loop only continues after a signal.
+async function sendFromDevice(data: Uint8Array): Promise<void> {
+    let offset = 0;
+    while (offset < data.length) {
+        const written = Number(await libc.writeAsync(master, data.subarray(offset), BigInt(data.length - offset)));
+        if (written <= 0) {
+            throw new Error("write to the pseudo-terminal master failed");
+        }
+        offset += written;
+    }
+}
+
+function receiveOnDevice(size: number): void {
+    const buffer = new Uint8Array(size);
+    let received = 0;
+    while (received < size) {
+        const bytes = Number(libc.read(master, buffer.subarray(received), BigInt(size - received)));
+        if (bytes <= 0) {
+            throw new Error("read from the pseudo-terminal master failed");
+        }
+        received += bytes;
+    }
+}
+
+const naiveBuffer = new Uint8Array(64 * 1024);
+const naivePointer = Deno.UnsafePointer.of(naiveBuffer);
+
+function naiveRead(size: number): Uint8Array[] {
+    const chunks: Uint8Array[] = [];
+    let received = 0;
+    while (received < size) {
+        const want = Math.min(naiveBuffer.length, size - received);
+        const bytes = lib.serialRead(handle64, naivePointer, want, 1000, 1, null);
+        if (bytes < 0) {
+            throw new Error(`serialRead failed with status ${bytes}`);
+        }
+        chunks.push(naiveBuffer.slice(0, bytes));
+        received += bytes;
+    }
+    return chunks;
+}
+
+const reader = serialReadable(lib, handle).getReader({ mode: "byob" });
+let streamBuffer = new ArrayBuffer(64 * 1024);
+
+async function streamRead(size: number): Promise<void> {
+    let received = 0;
+    while (received < size) {
+        const want = Math.min(streamBuffer.byteLength, size - received);
+        const { value } = await reader.read(new Uint8Array(streamBuffer, 0, want));
+        if (value === undefined) {
+            throw new Error("stream ended");
+        }
+        streamBuffer = value.buffer as ArrayBuffer;
+        received += value.byteLength;
+    }
+}
+
+const writer = serialWritable(lib, handle).getWriter();
+
+Deno.bench({
+    name: "naive serialRead loop, 1 MiB per iteration",
+    group: "throughput",
+    baseline: true,
+    async fn() {
+        const sent = sendFromDevice(payload);
+        naiveRead(payload.length);
+        await sent;
+    },
+});
+
+Deno.bench({
+    name: "BYOB stream reader, 1 MiB per iteration",
+    group: "throughput",
+    async fn() {
+        const sent = sendFromDevice(payload);
+        await streamRead(payload.length);
+        await sent;
+    },
+});
+
+Deno.bench({
+    name: "naive serialRead, 64-byte chunk",
+    group: "read chunk",
+    baseline: true,
+    fn() {
+        libc.write(master, chunk, BigInt(chunk.length));
+        naiveRead(chunk.length);
+    },
+});
+
+Deno.bench({
+    name: "BYOB stream reader, 64-byte chunk",
+    group: "read chunk",
+    async fn() {
+        libc.write(master, chunk, BigInt(chunk.length));
+        await streamRead(chunk.length);
+    },
+});
+
+Deno.bench({
+    name: "serialWrite, 64-byte chunk",
+    group: "write chunk",
+    baseline: true,
+    fn() {
+        lib.serialWrite(handle64, Deno.UnsafePointer.of(chunk), chunk.length, 1000, 1, null);
+        receiveOnDevice(chunk.length);
+    },
+});
+
+Deno.bench({
+    name: "stream writer, 64-byte chunk",
+    group: "write chunk",
+    async fn() {
+        await writer.write(chunk);
+        receiveOnDevice(chunk.length);
+    },
+});
@@ -0,0 +1,111 @@
+/**
+ * `Deno.dlopen` symbol definitions for the shared library shipped in `@serial/cpp-bindings-linux/bin`.
+ *
+ * `symbols` describes the cpp-core ABI (i64 handles, error callback pointers). `fastSymbols` describes the lean
+ * `serialFast*` entry points: i32 handles and no callback parameter, which keeps every call on V8's fast API
+ * path. Failures are returned as negative status codes; the message is available through {@link lastError}.
+ * `streamSymbols` holds the nonblocking variants behind the streams module.
+ *
+ * @example
+ * ```ts
+ * import { fastSymbols, lastError } from '@serial/cpp-bindings-linux/ffi'
+ *
+ * const lib = Deno.dlopen('./libcpp_bindings_linux.so', fastSymbols)
+ * const handle = lib.symbols.serialFastOpen(new TextEncoder().encode('/dev/ttyUSB0\0'), 115200, 8, 0, 1)
+ * if (handle < 0) throw new Error(lastError(lib.symbols).message)
+ * ```
+ * @module
+ */
+
+/** cpp-core ABI: i64 handles, optional error callback pointer as the last parameter. */
+export const symbols = {
+    serialOpen: {
+        parameters: ['pointer', 'i32', 'i32', 'i32', 'i32', 'pointer'],
+        result: 'i64',
+    },
+    serialClose: {
+        parameters: ['i64', 'pointer'],
+        result: 'i32',
+    },
+    serialRead: {
+        parameters: ['i64', 'pointer', 'i32', 'i32', 'i32', 'pointer'],
+        result: 'i32',
+    },
+    serialWrite: {
+        parameters: ['i64', 'pointer', 'i32', 'i32', 'i32', 'pointer'],
+        result: 'i32',
+    },
+} as const satisfies Deno.ForeignLibraryInterface
+
+/** Fast-call entry points: i32 handles, `buffer` arguments, no callbacks. */
+export const fastSymbols = {
+    serialFastOpen: {
+        parameters: ['buffer', 'i32', 'i32', 'i32', 'i32'],
+        result: 'i32',
+    },
+    serialFastClose: {
+        parameters: ['i32'],
+        result: 'i32',
+    },
+    serialFastRead: {
+        parameters: ['i32', 'buffer', 'i32', 'i32'],
+        result: 'i32',
+    },
+    serialFastWrite: {
+        parameters: ['i32', 'buffer', 'i32', 'i32'],
+        result: 'i32',
+    },
+    serialFastLastError: {
+        parameters: ['buffer', 'i32'],
+        result: 'i32',
+    },
+} as const satisfies Deno.ForeignLibraryInterface
+
+/**
+ * Entry points used by `@serial/cpp-bindings-linux/streams`, declared `nonblocking` so each call runs on a worker
+ * thread and returns a promise instead of stalling the event loop.
+ *
+ * Thread-local state does not carry over between those threads, so {@link lastError} cannot be used after a
+ * nonblocking call; the returned status code is all there is.
+ */
+export const streamSymbols = {
+    serialFastReadAsync: {
+        name: 'serialFastRead',
+        parameters: ['i32', 'buffer', 'i32', 'i32'],
+        result: 'i32',
+        nonblocking: true,
+    },
+    serialWriteAllAsync: {
+        name: 'serialWriteAll',
+        parameters: ['i64', 'buffer', 'i32', 'i32', 'i32', 'pointer'],
+        result: 'i32',
+        nonblocking: true,
+    },
+    serialWaitOutputLowWaterAsync: {
+        name: 'serialWaitOutputLowWater',
+        parameters: ['i64', 'i32', 'pointer'],
+        result: 'i32',
+        nonblocking: true,
+    },
+    serialSetOutputLowWater: {
+        parameters: ['i64', 'i32', 'pointer'],
+        result: 'i32',
+    },
+} as const satisfies Deno.ForeignLibraryInterface
+
+/** Status code and message of the last failed `serialFast*` call on the calling thread. */
+export interface LastError {
+    code: number
+    message: string
+}
+
+const messageBuffer = new Uint8Array(256)
+
+/** Reads the error stored by the most recent failed `serialFast*` call. */
+export function lastError(
+    lib: Pick<Deno.StaticForeignLibraryInterface<typeof fastSymbols>, 'serialFastLastError'>,
+): LastError {
+    const code = lib.serialFastLastError(messageBuffer, messageBuffer.length)
+    const end = messageBuffer.indexOf(0)
+    return { code, message: new TextDecoder().decode(messageBuffer.subarray(0, end < 0 ? undefined : end)) }
+}
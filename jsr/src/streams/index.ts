@@ -0,0 +1,181 @@
+/**
+ * Web Streams on top of a port opened with `serialFastOpen`.
+ *
+ * The readable side is a byte stream: a BYOB reader hands its own buffer to the native read, so received bytes
+ * land in caller memory without an intermediate copy. Default readers work as well and get chunks of
+ * `chunkSize` bytes allocated by the stream. The writable side passes every chunk to `serialWriteAll` in one
+ * call and only resolves once the kernel has taken all of it; together with a byte-counting queuing strategy
+ * this gives `writer.ready` / `desiredSize` backpressure that reaches down to the port.
+ *
+ * All native calls are `nonblocking` FFI calls (see `streamSymbols`), so waiting for the port never blocks the
+ * event loop, and a read and a write can be in flight at the same time (the library allows one call per
+ * direction and handle concurrently).
+ *
+ * @example
+ * ```ts
+ * import { fastSymbols, streamSymbols } from '@serial/cpp-bindings-linux/ffi'
+ * import { serialStreams } from '@serial/cpp-bindings-linux/streams'
+ *
+ * const lib = Deno.dlopen('./libcpp_bindings_linux.so', { ...fastSymbols, ...streamSymbols })
+ * const handle = lib.symbols.serialFastOpen(new TextEncoder().encode('/dev/ttyUSB0\0'), 115200, 8, 0, 1)
+ * const { readable, writable } = serialStreams(lib.symbols, handle)
+ *
+ * const reader = readable.getReader({ mode: 'byob' })
+ * let buffer = new ArrayBuffer(4096)
+ * const { value } = await reader.read(new Uint8Array(buffer))
+ * buffer = value!.buffer // the buffer comes back with the result and can be reused
+ * ```
+ * @module
+ */
+
+import type { streamSymbols } from '../ffi/index.ts'
+
+/** The subset of the loaded library the streams need. */
+export type StreamSymbols = Deno.StaticForeignLibraryInterface<typeof streamSymbols>
+
+/** Options for {@link serialStreams}, {@link serialReadable} and {@link serialWritable}. */
+export interface SerialStreamOptions {
+    /** Size of the chunks allocated for default (non-BYOB) readers. Default: 64 KiB. */
+    chunkSize?: number
+    /**
+     * Longest single native wait for data, in milliseconds. A read that times out is simply retried; the value
+     * only bounds how long `cancel()` takes to take effect. Default: 100.
+     */
+    readTimeoutMs?: number
+    /**
+     * Time budget of each native write call, in milliseconds. A call that times out is retried; the value only
+     * bounds how long `writer.abort()` takes to take effect on a stalled port. Default: 1000.
+     */
+    writeTimeoutMs?: number
+    /** Bytes the writable side queues before `writer.ready` stays pending. Default: 64 KiB. */
+    highWaterMark?: number
+    /**
+     * When set, each write also waits until the kernel output queue has drained to this many bytes
+     * (`serialWaitOutputLowWater`), so data does not pile up in the driver faster than the UART sends it.
+     */
+    outputLowWater?: number
+}
+
+/** A native call of the streams layer returned a negative `cpp_core::StatusCodes` value. */
+export class SerialStreamError extends Error {
+    /** The status code, see `cpp_core/status_codes.h`. */
+    readonly code: number
+
+    constructor(call: string, code: number) {
+        super(`${call} failed with status ${code}`)
+        this.name = 'SerialStreamError'
+        this.code = code
+    }
+}
+
+const defaultChunkSize = 64 * 1024
+const defaultReadTimeoutMs = 100
+const defaultWriteTimeoutMs = 1000
+const defaultHighWaterMark = 64 * 1024
+
+// The native size parameters are i32; larger chunks are written in slices of this size.
+const maxCallBytes = 0x4000_0000
+
+/** Creates a byte stream that reads from `handle`. Cancelling it leaves the handle open. */
+export function serialReadable(
+    lib: Pick<StreamSymbols, 'serialFastReadAsync'>,
+    handle: number,
+    options: SerialStreamOptions = {},
+): ReadableStream<Uint8Array> {
+    const timeoutMs = options.readTimeoutMs ?? defaultReadTimeoutMs
+    let cancelled = false
+
+    return new ReadableStream({
+        type: 'bytes',
+        autoAllocateChunkSize: options.chunkSize ?? defaultChunkSize,
+
+        async pull(controller) {
+            // autoAllocateChunkSize guarantees a request, for default readers as well as BYOB readers.
+            const request = controller.byobRequest!
+            const view = request.view!
+            const target = new Uint8Array(view.buffer, view.byteOffset, Math.min(view.byteLength, maxCallBytes))
+            while (!cancelled) {
+                const result = await lib.serialFastReadAsync(handle, target, target.byteLength, timeoutMs)
+                if (cancelled) {
+                    return
+                }
+                if (result > 0) {
+                    request.respond(result)
+                    return
+                }
+                if (result < 0) {
+                    controller.error(new SerialStreamError('serialFastRead', result))
+                    return
+                }
+            }
+        },
+
+        cancel() {
+            cancelled = true
+        },
+    })
+}
+
+/** Creates a stream that writes to `handle`. Closing or aborting it leaves the handle open. */
+export function serialWritable(
+    lib: Pick<StreamSymbols, 'serialWriteAllAsync' | 'serialWaitOutputLowWaterAsync' | 'serialSetOutputLowWater'>,
+    handle: number,
+    options: SerialStreamOptions = {},
+): WritableStream<Uint8Array> {
+    const timeoutMs = options.writeTimeoutMs ?? defaultWriteTimeoutMs
+    const lowWater = options.outputLowWater
+    const handle64 = BigInt(handle)
+
+    const waitForLowWater = async (signal: AbortSignal) => {
+        for (;;) {
+            signal.throwIfAborted()
+            const result = await lib.serialWaitOutputLowWaterAsync(handle64, timeoutMs, null)
+            if (result < 0) {
+                throw new SerialStreamError('serialWaitOutputLowWater', result)
+            }
+            if (result > 0) {
+                return
+            }
+        }
+    }
+
+    return new WritableStream<Uint8Array>({
+        start() {
+            if (lowWater !== undefined) {
+                const result = lib.serialSetOutputLowWater(handle64, lowWater, null)
+                if (result < 0) {
+                    throw new SerialStreamError('serialSetOutputLowWater', result)
+                }
+            }
+        },
+
+        async write(chunk, controller) {
+            // The chunk is passed to the native side as is; callers must not modify it until the write resolves.
+            // writer.abort() does not wait for this write, but its signal fires at once: the retry loops stop
+            // after the native call in flight.
+            const signal = controller.signal
+            let offset = 0
+            while (offset < chunk.byteLength) {
+                signal.throwIfAborted()
+                const rest = chunk.subarray(offset, offset + Math.min(chunk.byteLength - offset, maxCallBytes))
+                const result = await lib.serialWriteAllAsync(handle64, rest, rest.byteLength, timeoutMs, 0, null)
+                if (result < 0) {
+                    throw new SerialStreamError('serialWriteAll', result)
+                }
+                offset += result
+            }
+            if (lowWater !== undefined) {
+                await waitForLowWater(signal)
+            }
+        },
+    }, new ByteLengthQueuingStrategy({ highWaterMark: options.highWaterMark ?? defaultHighWaterMark }))
+}
+
+/** Readable and writable side of one handle, see {@link serialReadable} and {@link serialWritable}. */
+export function serialStreams(
+    lib: StreamSymbols,
+    handle: number,
+    options: SerialStreamOptions = {},
+): { readable: ReadableStream<Uint8Array>; writable: WritableStream<Uint8Array> } {
+    return { readable: serialReadable(lib, handle, options), writable: serialWritable(lib, handle, options) }
+}
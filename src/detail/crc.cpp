@@ -0,0 +1,354 @@
+#include "crc.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace cpp_bindings_linux::detail
+{
+namespace
+{
+template <typename T>
+using SliceTables = std::array<std::array<T, 256>, 8>;
+
+// Slicing-by-8 tables for LSB-first (reflected) CRCs. tables[k][i] is the CRC of byte i followed by k zero bytes.
+template <typename T>
+consteval auto makeReflectedTables(T poly) -> SliceTables<T>
+{
+    SliceTables<T> tables{};
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        T crc = static_cast<T>(i);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = static_cast<T>((crc & 1U) != 0 ? (crc >> 1U) ^ poly : crc >> 1U);
+        }
+        tables[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        for (std::size_t k = 1; k < tables.size(); ++k)
+        {
+            const T prev = tables[k - 1][i];
+            tables[k][i] = static_cast<T>((prev >> 8U) ^ tables[0][prev & 0xFFU]);
+        }
+    }
+    return tables;
+}
+
+// Slicing-by-8 tables for the MSB-first 16-bit CRC (CCITT).
+consteval auto makeMsbTables16(uint16_t poly) -> SliceTables<uint16_t>
+{
+    SliceTables<uint16_t> tables{};
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        auto crc = static_cast<uint16_t>(i << 8U);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = static_cast<uint16_t>((crc & 0x8000U) != 0 ? (crc << 1U) ^ poly : crc << 1U);
+        }
+        tables[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        for (std::size_t k = 1; k < tables.size(); ++k)
+        {
+            const uint16_t prev = tables[k - 1][i];
+            tables[k][i] = static_cast<uint16_t>((prev << 8U) ^ tables[0][prev >> 8U]);
+        }
+    }
+    return tables;
+}
+
+constexpr auto kCrc16ModbusTables = makeReflectedTables<uint16_t>(0xA001);
+constexpr auto kCrc16CcittTables = makeMsbTables16(0x1021);
+constexpr auto kCrc32Tables = makeReflectedTables<uint32_t>(0xEDB88320);
+constexpr auto kCrc32cTables = makeReflectedTables<uint32_t>(0x82F63B78);
+
+template <typename T>
+auto reflectedBytewise(const SliceTables<T> &tables, uint32_t crc, const unsigned char *data, std::size_t size)
+    -> uint32_t
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc = tables[0][(crc ^ data[i]) & 0xFFU] ^ (crc >> 8U);
+    }
+    return crc;
+}
+
+template <typename T>
+auto reflectedSlice8(const SliceTables<T> &tables, uint32_t crc, const unsigned char *data, std::size_t size)
+    -> uint32_t
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        while (size >= 8)
+        {
+            uint32_t low = 0;
+            uint32_t high = 0;
+            std::memcpy(&low, data, sizeof(low));
+            std::memcpy(&high, data + 4, sizeof(high));
+            low ^= crc;
+            crc = tables[7][low & 0xFFU] ^ tables[6][(low >> 8U) & 0xFFU] ^ tables[5][(low >> 16U) & 0xFFU] ^
+                  tables[4][low >> 24U] ^ tables[3][high & 0xFFU] ^ tables[2][(high >> 8U) & 0xFFU] ^
+                  tables[1][(high >> 16U) & 0xFFU] ^ tables[0][high >> 24U];
+            data += 8;
+            size -= 8;
+        }
+    }
+    return reflectedBytewise(tables, crc, data, size);
+}
+
+auto msb16Bytewise(uint32_t crc, const unsigned char *data, std::size_t size) -> uint32_t
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc = ((crc << 8U) & 0xFFFFU) ^ kCrc16CcittTables[0][((crc >> 8U) ^ data[i]) & 0xFFU];
+    }
+    return crc;
+}
+
+auto msb16Slice8(uint32_t crc, const unsigned char *data, std::size_t size) -> uint32_t
+{
+    const auto &tables = kCrc16CcittTables;
+    while (size >= 8)
+    {
+        crc = tables[7][data[0] ^ (crc >> 8U)] ^ tables[6][data[1] ^ (crc & 0xFFU)] ^ tables[5][data[2]] ^
+              tables[4][data[3]] ^ tables[3][data[4]] ^ tables[2][data[5]] ^ tables[1][data[6]] ^ tables[0][data[7]];
+        data += 8;
+        size -= 8;
+    }
+    return msb16Bytewise(crc, data, size);
+}
+
+#if defined(__x86_64__)
+// One folding step: acc * x^k (both 64-bit halves) xor next.
+__attribute__((target("pclmul"))) inline auto fold(__m128i acc, __m128i keys, __m128i next) -> __m128i
+{
+    const __m128i low = _mm_clmulepi64_si128(acc, keys, 0x00);
+    const __m128i high = _mm_clmulepi64_si128(acc, keys, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(high, low), next);
+}
+
+// CRC32 (ISO-HDLC) by carry-less multiplication folding, after Intel's "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction". Takes and returns the raw (non-inverted) register;
+// size must be a multiple of 16 and at least 64.
+__attribute__((target("pclmul,sse4.1"))) auto crc32FoldPclmul(uint32_t crc, const unsigned char *data,
+                                                               std::size_t size) -> uint32_t
+{
+    alignas(16) static constexpr std::array<uint64_t, 2> kK1K2 = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static constexpr std::array<uint64_t, 2> kK3K4 = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static constexpr std::array<uint64_t, 2> kK5K0 = {0x0163cd6124, 0x0000000000};
+    alignas(16) static constexpr std::array<uint64_t, 2> kPoly = {0x01db710641, 0x01f7011641};
+
+    const auto load = [](const unsigned char *ptr) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+    };
+
+    __m128i x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x2 = load(data + 16);
+    __m128i x3 = load(data + 32);
+    __m128i x4 = load(data + 48);
+    data += 64;
+    size -= 64;
+
+    __m128i keys = _mm_load_si128(reinterpret_cast<const __m128i *>(kK1K2.data()));
+    while (size >= 64)
+    {
+        x1 = fold(x1, keys, load(data));
+        x2 = fold(x2, keys, load(data + 16));
+        x3 = fold(x3, keys, load(data + 32));
+        x4 = fold(x4, keys, load(data + 48));
+        data += 64;
+        size -= 64;
+    }
+
+    keys = _mm_load_si128(reinterpret_cast<const __m128i *>(kK3K4.data()));
+    x1 = fold(x1, keys, x2);
+    x1 = fold(x1, keys, x3);
+    x1 = fold(x1, keys, x4);
+    while (size >= 16)
+    {
+        x1 = fold(x1, keys, load(data));
+        data += 16;
+        size -= 16;
+    }
+
+    // 128 -> 64 bits.
+    __m128i reduced = _mm_clmulepi64_si128(x1, keys, 0x10);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), reduced);
+
+    // 64 -> 32 bits.
+    keys = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(kK5K0.data()));
+    reduced = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), keys, 0x00), reduced);
+
+    // Barrett reduction.
+    keys = _mm_load_si128(reinterpret_cast<const __m128i *>(kPoly.data()));
+    reduced = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), keys, 0x10);
+    reduced = _mm_clmulepi64_si128(_mm_and_si128(reduced, mask32), keys, 0x00);
+    x1 = _mm_xor_si128(x1, reduced);
+
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+__attribute__((target("sse4.2"))) auto crc32cHardware(uint32_t crc, const unsigned char *data, std::size_t size)
+    -> uint32_t
+{
+    uint64_t crc64 = crc;
+    while (size >= 8)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        size -= 8;
+    }
+    auto crc32 = static_cast<uint32_t>(crc64);
+    while (size > 0)
+    {
+        crc32 = _mm_crc32_u8(crc32, *data);
+        ++data;
+        --size;
+    }
+    return crc32;
+}
+#endif
+
+using CrcKernel = uint32_t (*)(const unsigned char *, std::size_t);
+
+// Picks the fastest kernel per CRC kind once, on first use.
+auto selectKernels() -> std::array<CrcKernel, 4>
+{
+    return {
+        &crc16ModbusSlice8,
+        &crc16CcittSlice8,
+        hasCrc32Pclmul() ? &crc32Pclmul : &crc32Slice8,
+        hasCrc32cSse42() ? &crc32cSse42 : &crc32cSlice8,
+    };
+}
+} // namespace
+
+auto crc16ModbusBytewise(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return reflectedBytewise(kCrc16ModbusTables, 0xFFFF, data, size);
+}
+
+auto crc16ModbusSlice8(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return reflectedSlice8(kCrc16ModbusTables, 0xFFFF, data, size);
+}
+
+auto crc16CcittBytewise(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return msb16Bytewise(0xFFFF, data, size);
+}
+
+auto crc16CcittSlice8(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return msb16Slice8(0xFFFF, data, size);
+}
+
+auto crc32Bytewise(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return ~reflectedBytewise(kCrc32Tables, 0xFFFFFFFF, data, size);
+}
+
+auto crc32Slice8(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return ~reflectedSlice8(kCrc32Tables, 0xFFFFFFFF, data, size);
+}
+
+auto crc32cBytewise(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return ~reflectedBytewise(kCrc32cTables, 0xFFFFFFFF, data, size);
+}
+
+auto crc32cSlice8(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    return ~reflectedSlice8(kCrc32cTables, 0xFFFFFFFF, data, size);
+}
+
+auto hasCrc32Pclmul() -> bool
+{
+#if defined(__x86_64__)
+    static const bool supported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+auto hasCrc32cSse42() -> bool
+{
+#if defined(__x86_64__)
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+auto crc32Pclmul(const unsigned char *data, std::size_t size) -> uint32_t
+{
+    uint32_t crc = 0xFFFFFFFF;
+#if defined(__x86_64__)
+    if (size >= 64)
+    {
+        const std::size_t chunk = size & ~static_cast<std::size_t>(15);
+        crc = crc32FoldPclmul(crc, data, chunk);
+        data += chunk;
+        size -= chunk;
+    }
+#endif
+    return ~reflectedSlice8(kCrc32Tables, crc, data, size);
+}
+
+auto crc32cSse42(const unsigned char *data, std::size_t size) -> uint32_t
+{
+#if defined(__x86_64__)
+    return ~crc32cHardware(0xFFFFFFFF, data, size);
+#else
+    return crc32cSlice8(data, size);
+#endif
+}
+
+auto crcCompute(CrcKind kind, const unsigned char *data, std::size_t size) -> uint32_t
+{
+    static const std::array<CrcKernel, 4> kernels = selectKernels();
+    return kernels[static_cast<std::size_t>(kind)](data, size);
+}
+
+auto crcStore(CrcKind kind, uint32_t crc, unsigned char *out) -> void
+{
+    if (kind == CrcKind::kCrc16Ccitt)
+    {
+        out[0] = static_cast<unsigned char>(crc >> 8U);
+        out[1] = static_cast<unsigned char>(crc);
+        return;
+    }
+    for (int i = 0; i < crcWidthBytes(kind); ++i)
+    {
+        out[i] = static_cast<unsigned char>(crc >> (8U * static_cast<unsigned>(i)));
+    }
+}
+
+auto crcLoad(CrcKind kind, const unsigned char *in) -> uint32_t
+{
+    if (kind == CrcKind::kCrc16Ccitt)
+    {
+        return (static_cast<uint32_t>(in[0]) << 8U) | in[1];
+    }
+    uint32_t crc = 0;
+    for (int i = 0; i < crcWidthBytes(kind); ++i)
+    {
+        crc |= static_cast<uint32_t>(in[i]) << (8U * static_cast<unsigned>(i));
+    }
+    return crc;
+}
+} // namespace cpp_bindings_linux::detail
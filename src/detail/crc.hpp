@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cpp_bindings_linux::detail
+{
+// Values match SerialCrcKind in <cpp_bindings_linux/interface/serial_crc.h>.
+enum class CrcKind : int
+{
+    kCrc16Modbus = 0, // reflected 0x8005, init 0xFFFF, sent low byte first
+    kCrc16Ccitt = 1,  // CRC-16/CCITT-FALSE: 0x1021, init 0xFFFF, sent high byte first
+    kCrc32 = 2,       // ISO-HDLC (zlib/Ethernet): reflected 0x04C11DB7, init/xorout 0xFFFFFFFF, low byte first
+    kCrc32c = 3,      // Castagnoli: reflected 0x1EDC6F41, init/xorout 0xFFFFFFFF, low byte first
+};
+
+inline auto isValidCrcKind(int kind) -> bool
+{
+    return kind >= static_cast<int>(CrcKind::kCrc16Modbus) && kind <= static_cast<int>(CrcKind::kCrc32c);
+}
+
+// Size of the CRC trailer on the wire.
+inline auto crcWidthBytes(CrcKind kind) -> int
+{
+    return (kind == CrcKind::kCrc16Modbus || kind == CrcKind::kCrc16Ccitt) ? 2 : 4;
+}
+
+// Complete CRC (init and xorout applied) using the fastest kernel available on this CPU.
+auto crcCompute(CrcKind kind, const unsigned char *data, std::size_t size) -> uint32_t;
+
+// Stores a CRC in the wire byte order of its kind; out must have room for crcWidthBytes(kind) bytes.
+auto crcStore(CrcKind kind, uint32_t crc, unsigned char *out) -> void;
+
+// Reads a CRC stored by crcStore().
+auto crcLoad(CrcKind kind, const unsigned char *in) -> uint32_t;
+
+// Individual kernels, exposed for tests and benchmarks. All return the complete CRC.
+auto crc16ModbusBytewise(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc16ModbusSlice8(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc16CcittBytewise(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc16CcittSlice8(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc32Bytewise(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc32Slice8(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc32cBytewise(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc32cSlice8(const unsigned char *data, std::size_t size) -> uint32_t;
+
+// Hardware kernels. Only call them when the matching has*() probe returns true.
+auto hasCrc32Pclmul() -> bool;
+auto hasCrc32cSse42() -> bool;
+auto crc32Pclmul(const unsigned char *data, std::size_t size) -> uint32_t;
+auto crc32cSse42(const unsigned char *data, std::size_t size) -> uint32_t;
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,380 @@
+#include "fd_bridge.hpp"
+
+#include <cpp_core/status_codes.h>
+
+#include "port_registry.hpp"
+#include "thread_tuning.hpp"
+
+#include <array>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <utility>
+
+namespace cpp_bindings_linux::detail
+{
+namespace
+{
+// Bytes moved per transfer; the default pipe capacity, so one splice fills the pipe at most.
+constexpr std::size_t kChunkSize = 64 * 1024;
+
+constexpr unsigned int kSpliceFlags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+auto retryLater(int error_number) -> bool
+{
+    return error_number == EAGAIN || error_number == EWOULDBLOCK || error_number == EINTR;
+}
+
+auto finish(BridgePump &pump, int error_number) -> void
+{
+    pump.done = true;
+    pump.error_number = error_number;
+}
+
+// Leaves splice mode; bytes already in the pipe move to the copy buffer so they go out first.
+auto switchToCopy(BridgePump &pump) -> void
+{
+    pump.splice = false;
+    pump.copy_buffer.resize(kChunkSize);
+    if (pump.in_pipe > 0)
+    {
+        const ssize_t bytes = ::read(pump.pipe_read.get(), pump.copy_buffer.data(), pump.in_pipe);
+        pump.copy_offset = 0;
+        pump.copy_size = bytes > 0 ? static_cast<std::size_t>(bytes) : 0;
+        pump.in_pipe = 0;
+    }
+    pump.pipe_read.reset(-1);
+    pump.pipe_write.reset(-1);
+}
+
+auto fill(BridgePump &pump) -> void
+{
+    if (pump.splice)
+    {
+        const ssize_t bytes = ::splice(pump.src, nullptr, pump.pipe_write.get(), nullptr, kChunkSize, kSpliceFlags);
+        if (bytes > 0)
+        {
+            pump.in_pipe = static_cast<std::size_t>(bytes);
+            return;
+        }
+        if (bytes < 0 && errno == EINVAL)
+        {
+            switchToCopy(pump);
+        }
+        else
+        {
+            if (bytes == 0 || !retryLater(errno))
+            {
+                finish(pump, bytes == 0 ? 0 : errno);
+            }
+            return;
+        }
+    }
+
+    const ssize_t bytes = ::read(pump.src, pump.copy_buffer.data(), pump.copy_buffer.size());
+    if (bytes > 0)
+    {
+        pump.copy_offset = 0;
+        pump.copy_size = static_cast<std::size_t>(bytes);
+    }
+    else if (bytes == 0 || !retryLater(errno))
+    {
+        finish(pump, bytes == 0 ? 0 : errno);
+    }
+}
+
+auto drain(BridgePump &pump) -> void
+{
+    if (pump.in_pipe > 0)
+    {
+        const ssize_t bytes = ::splice(pump.pipe_read.get(), nullptr, pump.dst, nullptr, pump.in_pipe, kSpliceFlags);
+        if (bytes > 0)
+        {
+            pump.in_pipe -= static_cast<std::size_t>(bytes);
+            pump.bytes += static_cast<uint64_t>(bytes);
+            pump.spliced_bytes += static_cast<uint64_t>(bytes);
+            return;
+        }
+        if (bytes < 0 && errno == EINVAL)
+        {
+            switchToCopy(pump);
+        }
+        else
+        {
+            if (bytes == 0 || !retryLater(errno))
+            {
+                finish(pump, bytes == 0 ? EPIPE : errno);
+            }
+            return;
+        }
+    }
+
+    const ssize_t bytes =
+        ::write(pump.dst, pump.copy_buffer.data() + pump.copy_offset, pump.copy_size - pump.copy_offset);
+    if (bytes > 0)
+    {
+        pump.copy_offset += static_cast<std::size_t>(bytes);
+        pump.bytes += static_cast<uint64_t>(bytes);
+        if (pump.copy_offset == pump.copy_size)
+        {
+            pump.copy_offset = 0;
+            pump.copy_size = 0;
+        }
+    }
+    else if (bytes < 0 && !retryLater(errno))
+    {
+        finish(pump, errno);
+    }
+}
+
+auto drainWakeFd(int fd) -> void
+{
+    uint64_t value = 0;
+    (void)read(fd, &value, sizeof(value));
+}
+} // namespace
+
+auto makePump(int src, int dst, bool splice) -> std::unique_ptr<BridgePump>
+{
+    auto pump = std::make_unique<BridgePump>(src, dst, splice);
+    if (splice)
+    {
+        std::array<int, 2> pipe_fds{-1, -1};
+        if (pipe2(pipe_fds.data(), O_NONBLOCK | O_CLOEXEC) == 0)
+        {
+            pump->pipe_read.reset(pipe_fds[0]);
+            pump->pipe_write.reset(pipe_fds[1]);
+            return pump;
+        }
+        pump->splice = false;
+    }
+    pump->copy_buffer.resize(kChunkSize);
+    return pump;
+}
+
+auto stepPump(BridgePump &pump, int port_fd) -> void
+{
+    PortState *state = PortRegistry::instance().find(port_fd);
+    const auto lockSide = [state](bool port_is_src) {
+        if (state == nullptr)
+        {
+            return std::unique_lock<std::mutex>();
+        }
+        return std::unique_lock<std::mutex>(port_is_src ? state->read.mutex : state->write.mutex);
+    };
+
+    // Raw bytes must not mix with the frames of compressed-stream mode, in either direction, and the fan-out
+    // reader has the port's input to itself. There is no caller to report to; the direction just ends.
+    if (!pump.pending())
+    {
+        const auto side_lock = pump.src == port_fd ? lockSide(true) : std::unique_lock<std::mutex>();
+        if (pump.src == port_fd && rejectFanoutRead(state, nullptr))
+        {
+            finish(pump, EBUSY);
+            return;
+        }
+        if (pump.src == port_fd && rejectCompressedRead(state, nullptr))
+        {
+            finish(pump, EPROTO);
+            return;
+        }
+        fill(pump);
+    }
+    // Pass fresh data on at once: the destination is usually ready, and that saves a poll round per chunk.
+    if (pump.pending() && !pump.done)
+    {
+        const auto side_lock = pump.dst == port_fd ? lockSide(false) : std::unique_lock<std::mutex>();
+        if (pump.dst == port_fd && rejectCompressedWrite(state, nullptr))
+        {
+            finish(pump, EPROTO);
+            return;
+        }
+        drain(pump);
+    }
+}
+
+auto BridgeReactor::instance() -> BridgeReactor &
+{
+    // Intentionally leaked, like the port registry: the thread may outlive static destruction.
+    static auto *reactor = new BridgeReactor();
+    return *reactor;
+}
+
+auto BridgeReactor::add(std::unique_ptr<Bridge> bridge) -> SerialResult<int64_t>
+{
+    const std::scoped_lock lock(mutex_);
+    if (!wake_fd_.valid())
+    {
+        wake_fd_.reset(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+        if (!wake_fd_.valid())
+        {
+            return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, errno, nullptr});
+        }
+    }
+
+    const int64_t id = next_id_++;
+    bridges_.emplace(id, std::move(bridge));
+    if (thread_.joinable())
+    {
+        wake();
+        return id;
+    }
+    try
+    {
+        thread_ = std::jthread([this](const std::stop_token &stop) { run(stop); });
+    }
+    catch (const std::system_error &error)
+    {
+        bridges_.erase(id);
+        return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, error.code().value(), nullptr});
+    }
+    return id;
+}
+
+auto BridgeReactor::remove(int64_t id) -> bool
+{
+    std::jthread stopped;
+    {
+        const std::scoped_lock lock(mutex_);
+        if (bridges_.erase(id) == 0)
+        {
+            return false;
+        }
+        stopped = stopIfIdle();
+    }
+    // Joined outside the lock, because the thread takes it once more on its way out.
+    return true;
+}
+
+auto BridgeReactor::removePort(int port_fd) -> void
+{
+    std::jthread stopped;
+    {
+        const std::scoped_lock lock(mutex_);
+        std::erase_if(bridges_, [port_fd](const auto &entry) { return entry.second->port_fd == port_fd; });
+        stopped = stopIfIdle();
+    }
+}
+
+auto BridgeReactor::stopIfIdle() -> std::jthread
+{
+    std::jthread stopped;
+    if (bridges_.empty() && thread_.joinable())
+    {
+        thread_.request_stop();
+        stopped = std::move(thread_);
+    }
+    wake();
+    return stopped;
+}
+
+auto BridgeReactor::counters(int64_t id) -> std::optional<BridgeCounters>
+{
+    const std::scoped_lock lock(mutex_);
+    const auto entry = bridges_.find(id);
+    if (entry == bridges_.end())
+    {
+        return std::nullopt;
+    }
+
+    const Bridge &bridge = *entry->second;
+    BridgeCounters counters;
+    counters.started_ns = bridge.started_ns;
+    for (const BridgePump *pump : {bridge.to_fd.get(), bridge.from_fd.get()})
+    {
+        if (pump == nullptr)
+        {
+            continue;
+        }
+        counters.spliced_bytes += pump->spliced_bytes;
+        if (counters.error_number == 0)
+        {
+            counters.error_number = pump->error_number;
+        }
+    }
+    if (bridge.to_fd != nullptr)
+    {
+        counters.bytes_to_fd = bridge.to_fd->bytes;
+        counters.to_fd_running = !bridge.to_fd->done;
+    }
+    if (bridge.from_fd != nullptr)
+    {
+        counters.bytes_from_fd = bridge.from_fd->bytes;
+        counters.from_fd_running = !bridge.from_fd->done;
+    }
+    return counters;
+}
+
+auto BridgeReactor::wake() const -> void
+{
+    const uint64_t one = 1;
+    (void)write(wake_fd_.get(), &one, sizeof(one));
+}
+
+auto BridgeReactor::run(const std::stop_token &stop) -> void
+{
+    const TunedThreadScope tuned;
+    std::vector<struct pollfd> poll_fds;
+    std::vector<std::pair<int64_t, bool>> owners; // bridge id and direction (true = to_fd) per poll entry
+    while (!stop.stop_requested())
+    {
+        {
+            const std::scoped_lock lock(mutex_);
+            if (stop.stop_requested())
+            {
+                return;
+            }
+
+            poll_fds.clear();
+            owners.clear();
+            poll_fds.push_back({wake_fd_.get(), POLLIN, 0});
+            owners.emplace_back(0, false);
+            for (const auto &[id, bridge] : bridges_)
+            {
+                for (const bool to_fd : {true, false})
+                {
+                    const BridgePump *pump = to_fd ? bridge->to_fd.get() : bridge->from_fd.get();
+                    if (pump != nullptr && !pump->done)
+                    {
+                        poll_fds.push_back(pump->pending() ? pollfd{pump->dst, POLLOUT, 0}
+                                                           : pollfd{pump->src, POLLIN, 0});
+                        owners.emplace_back(id, to_fd);
+                    }
+                }
+            }
+        }
+
+        if (poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), -1) < 0 && errno != EINTR)
+        {
+            return;
+        }
+
+        const std::scoped_lock lock(mutex_);
+        if (stop.stop_requested())
+        {
+            return;
+        }
+        drainWakeFd(wake_fd_.get());
+        for (std::size_t i = 1; i < poll_fds.size(); ++i)
+        {
+            if (poll_fds[i].revents == 0)
+            {
+                continue;
+            }
+            const auto entry = bridges_.find(owners[i].first);
+            if (entry == bridges_.end())
+            {
+                continue; // stopped meanwhile
+            }
+            Bridge &bridge = *entry->second;
+            BridgePump *pump = owners[i].second ? bridge.to_fd.get() : bridge.from_fd.get();
+            if (pump != nullptr && !pump->done)
+            {
+                stepPump(*pump, bridge.port_fd);
+            }
+        }
+    }
+}
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cpp_bindings_linux/detail/unique_fd.hpp>
+#include <cpp_bindings_linux/serial_error.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace cpp_bindings_linux::detail
+{
+// One direction of a bridge (serialBridgeStart()): moves bytes from src to dst.
+//
+// In splice mode the bytes go src -> pipe -> dst without leaving the kernel; in_pipe counts what sits in the pipe.
+// The first transfer that the kernel refuses to splice (EINVAL: one side does not support it) switches the pump
+// to copy mode for good; whatever is already in the pipe is read out into the copy buffer first, so nothing is
+// lost or reordered. A pump either has data pending for dst or waits for src, never both.
+struct BridgePump
+{
+    BridgePump(int in_src, int in_dst, bool in_splice) : src(in_src), dst(in_dst), splice(in_splice)
+    {
+    }
+
+    [[nodiscard]] auto pending() const -> bool
+    {
+        return in_pipe > 0 || copy_offset < copy_size;
+    }
+
+    int src;
+    int dst;
+    bool splice;
+    bool done = false;    // end of file or error on either side
+    int error_number = 0; // errno that ended the pump, 0 for end of file
+
+    UniqueFd pipe_read;
+    UniqueFd pipe_write;
+    std::size_t in_pipe = 0;
+
+    std::vector<unsigned char> copy_buffer; // allocated when copy mode starts
+    std::size_t copy_offset = 0;
+    std::size_t copy_size = 0;
+
+    uint64_t bytes = 0;
+    uint64_t spliced_bytes = 0;
+};
+
+struct Bridge
+{
+    int port_fd = -1;
+    int64_t started_ns = 0;
+    std::unique_ptr<BridgePump> to_fd;   // port -> fd
+    std::unique_ptr<BridgePump> from_fd; // fd -> port
+};
+
+// Counters of one bridge, copied out under the reactor lock.
+struct BridgeCounters
+{
+    uint64_t bytes_to_fd = 0;
+    uint64_t bytes_from_fd = 0;
+    uint64_t spliced_bytes = 0;
+    int64_t started_ns = 0;
+    bool to_fd_running = false;
+    bool from_fd_running = false;
+    int error_number = 0;
+};
+
+// Background thread that runs every bridge.
+//
+// Each pass polls, for every pump that is still running, either its destination (POLLOUT, while it has data
+// pending) or its source (POLLIN), plus an eventfd for changes; a ready pump then makes one transfer. Port sides
+// are read and written under the port's read-side and write-side mutexes, like any other call on the handle. The
+// thread exits once no bridge is left.
+class BridgeReactor
+{
+  public:
+    static auto instance() -> BridgeReactor &;
+
+    // Returns the new bridge id.
+    auto add(std::unique_ptr<Bridge> bridge) -> SerialResult<int64_t>;
+
+    // Once these return the thread no longer touches the bridge's descriptors. remove() reports whether the bridge
+    // existed; removePort() stops every bridge of a port.
+    auto remove(int64_t id) -> bool;
+    auto removePort(int port_fd) -> void;
+
+    [[nodiscard]] auto counters(int64_t id) -> std::optional<BridgeCounters>;
+
+  private:
+    BridgeReactor() = default;
+
+    auto wake() const -> void;
+    // Called with the lock held; the returned thread (if any) is joined by the caller after unlocking.
+    auto stopIfIdle() -> std::jthread;
+    auto run(const std::stop_token &stop) -> void;
+
+    std::mutex mutex_;
+    std::map<int64_t, std::unique_ptr<Bridge>> bridges_;
+    int64_t next_id_ = 1;
+    UniqueFd wake_fd_;
+    std::jthread thread_;
+};
+
+// Sets up a pump; splice mode needs a pipe, and falls back to copy mode when none can be created.
+auto makePump(int src, int dst, bool splice) -> std::unique_ptr<BridgePump>;
+
+// Makes one transfer for a pump whose side of interest was reported ready: moves pending data on to dst, or
+// takes new data from src and tries to pass it on right away. port_fd tells which side is the port, so its side
+// mutex can be taken.
+auto stepPump(BridgePump &pump, int port_fd) -> void;
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,237 @@
+#include "link_compression.hpp"
+
+#include <cpp_core/status_codes.h>
+
+#include "crc.hpp"
+#include "posix_helpers.hpp"
+#include "read_loop.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <termios.h>
+
+namespace cpp_bindings_linux::detail
+{
+namespace
+{
+// Once a frame has been started, the rest of it is waited for at least this long even if the caller's timeout
+// has already passed: a half-written frame would desynchronize the other end for good.
+constexpr int kFrameCompletionMs = 1000;
+
+// Bytes taken from the fd per read in compressed mode.
+constexpr std::size_t kWireChunkSize = 4096;
+
+constexpr std::size_t kMaxFrameSize =
+    static_cast<std::size_t>(kFrameHeaderSize + lzCompressBound(kLzMaxBlockSize) + kFrameTrailerSize);
+
+auto corrupted(CompressedReader &reader) -> SerialResult<void>
+{
+    reader.decoder.reset();
+    reader.wire.clear();
+    reader.decoded.clear();
+    reader.decoded_offset = 0;
+    return std::unexpected(SerialError{cpp_core::StatusCodes::kReadError, EPROTO,
+                                       "Compressed stream is corrupted; re-enable on both ends"});
+}
+
+auto load16(const unsigned char *data) -> int
+{
+    return data[0] | (data[1] << 8);
+}
+
+auto takeDecoded(CompressedReader &reader, unsigned char *buffer, int buffer_size) -> std::size_t
+{
+    const std::size_t available = reader.decoded.size() - reader.decoded_offset;
+    const std::size_t count = std::min(available, static_cast<std::size_t>(buffer_size));
+    std::memcpy(buffer, reader.decoded.data() + reader.decoded_offset, count);
+    reader.decoded_offset += count;
+    if (reader.decoded_offset == reader.decoded.size())
+    {
+        reader.decoded.clear();
+        reader.decoded_offset = 0;
+    }
+    reader.raw_bytes += count;
+    return count;
+}
+} // namespace
+
+CompressedReader::CompressedReader()
+{
+    // wire never holds more than a partial frame plus one chunk. decoded grows past its reservation only when a
+    // single chunk carries more than a few highly compressed frames, and then keeps that capacity.
+    wire.reserve(kMaxFrameSize + kWireChunkSize);
+    decoded.reserve(static_cast<std::size_t>(4 * kLzMaxBlockSize));
+}
+
+CompressedWriter::CompressedWriter()
+{
+    frame.reserve(kMaxFrameSize);
+}
+
+auto encodeFrame(CompressedWriter &writer, const unsigned char *data, int size) -> void
+{
+    auto &frame = writer.frame;
+    frame.resize(static_cast<std::size_t>(kFrameHeaderSize + lzCompressBound(size) + kFrameTrailerSize));
+    unsigned char *payload = frame.data() + kFrameHeaderSize;
+
+    int payload_size = writer.encoder.compress(data, size, payload);
+    unsigned char kind = kFrameCompressed;
+    if (payload_size >= size)
+    {
+        std::memcpy(payload, data, static_cast<std::size_t>(size));
+        payload_size = size;
+        kind = kFrameStored;
+    }
+
+    frame[0] = kind;
+    frame[1] = static_cast<unsigned char>(size & 0xFF);
+    frame[2] = static_cast<unsigned char>(size >> 8);
+    frame[3] = static_cast<unsigned char>(payload_size & 0xFF);
+    frame[4] = static_cast<unsigned char>(payload_size >> 8);
+    crcStore(CrcKind::kCrc16Ccitt, crcCompute(CrcKind::kCrc16Ccitt, data, static_cast<std::size_t>(size)),
+             payload + payload_size);
+    frame.resize(static_cast<std::size_t>(kFrameHeaderSize + payload_size + kFrameTrailerSize));
+}
+
+auto decodeFrames(CompressedReader &reader) -> SerialResult<void>
+{
+    std::size_t consumed = 0;
+    while (reader.wire.size() - consumed >= static_cast<std::size_t>(kFrameHeaderSize))
+    {
+        const unsigned char *header = reader.wire.data() + consumed;
+        const unsigned char kind = header[0];
+        const int raw_size = load16(header + 1);
+        const int payload_size = load16(header + 3);
+        if ((kind != kFrameCompressed && kind != kFrameStored) || raw_size == 0 || raw_size > kLzMaxBlockSize ||
+            payload_size > lzCompressBound(raw_size) || (kind == kFrameStored && payload_size != raw_size))
+        {
+            return corrupted(reader);
+        }
+
+        const auto frame_size = static_cast<std::size_t>(kFrameHeaderSize + payload_size + kFrameTrailerSize);
+        if (reader.wire.size() - consumed < frame_size)
+        {
+            break;
+        }
+
+        const unsigned char *payload = header + kFrameHeaderSize;
+        const std::size_t out = reader.decoded.size();
+        reader.decoded.resize(out + static_cast<std::size_t>(raw_size));
+        unsigned char *raw = reader.decoded.data() + out;
+        if (kind == kFrameStored)
+        {
+            std::memcpy(raw, payload, static_cast<std::size_t>(raw_size));
+            reader.decoder.appendStored(raw, raw_size);
+        }
+        else if (!reader.decoder.decompress(payload, payload_size, raw_size, raw))
+        {
+            return corrupted(reader);
+        }
+
+        if (crcCompute(CrcKind::kCrc16Ccitt, raw, static_cast<std::size_t>(raw_size)) !=
+            crcLoad(CrcKind::kCrc16Ccitt, payload + payload_size))
+        {
+            return corrupted(reader);
+        }
+        consumed += frame_size;
+    }
+    reader.wire.erase(reader.wire.begin(), reader.wire.begin() + static_cast<std::ptrdiff_t>(consumed));
+    return {};
+}
+
+auto compressedRead(int fd, CompressedReader &reader, unsigned char *buffer, int buffer_size, int64_t timeout_ns)
+    -> SerialResult<std::size_t>
+{
+    const Deadline deadline = Deadline::afterNs(timeout_ns);
+    std::array<unsigned char, kWireChunkSize> chunk{};
+    NoReadObserver observer;
+    while (true)
+    {
+        if (reader.decoded_offset < reader.decoded.size())
+        {
+            return takeDecoded(reader, buffer, buffer_size);
+        }
+
+        const ssize_t bytes =
+            readWithTimeoutNs(fd, chunk.data(), static_cast<int>(chunk.size()), deadline.remainingNs(), observer);
+        if (bytes < 0)
+        {
+            return std::unexpected(SerialError{cpp_core::StatusCodes::kReadError, errno, nullptr});
+        }
+        if (bytes == 0)
+        {
+            return 0; // timeout; a partial frame stays buffered for the next call
+        }
+        reader.wire_bytes += static_cast<uint64_t>(bytes);
+        reader.wire.insert(reader.wire.end(), chunk.data(), chunk.data() + bytes);
+
+        const auto decoded = decodeFrames(reader);
+        if (!decoded)
+        {
+            return std::unexpected(decoded.error());
+        }
+    }
+}
+
+auto compressedWrite(int fd, CompressedWriter &writer, const unsigned char *data, int size, int64_t timeout_ns)
+    -> SerialResult<std::size_t>
+{
+    const Deadline deadline = Deadline::afterNs(timeout_ns);
+    int sent = 0;
+    while (sent < size)
+    {
+        // Only start a frame that can start now or within the caller's timeout.
+        const int ready = waitFdReadyNs(fd, deadline.remainingNs(), false);
+        if (ready < 0)
+        {
+            return std::unexpected(SerialError{cpp_core::StatusCodes::kWriteError, errno, nullptr});
+        }
+        if (ready == 0)
+        {
+            break;
+        }
+
+        const int block = std::min(size - sent, kLzMaxBlockSize);
+        encodeFrame(writer, data + sent, block);
+
+        const Deadline frame_deadline =
+            Deadline::afterNs(std::max(deadline.remainingNs(), static_cast<int64_t>(kFrameCompletionMs) * 1'000'000));
+        std::size_t written = 0;
+        while (written < writer.frame.size())
+        {
+            const ssize_t bytes = ::write(fd, writer.frame.data() + written, writer.frame.size() - written);
+            if (bytes > 0)
+            {
+                written += static_cast<std::size_t>(bytes);
+                continue;
+            }
+            if (bytes < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                writer.encoder.reset();
+                return std::unexpected(SerialError{cpp_core::StatusCodes::kWriteError, errno, nullptr});
+            }
+            const int frame_ready = waitFdReadyNs(fd, frame_deadline.remainingNs(), false);
+            if (frame_ready <= 0)
+            {
+                writer.encoder.reset();
+                return std::unexpected(frame_ready < 0
+                                           ? SerialError{cpp_core::StatusCodes::kWriteError, errno, nullptr}
+                                           : SerialError{cpp_core::StatusCodes::kWriteError, ETIMEDOUT,
+                                                         "Compressed frame cut short; re-enable on both ends"});
+            }
+        }
+        writer.wire_bytes += written;
+        writer.raw_bytes += static_cast<uint64_t>(block);
+        sent += block;
+    }
+
+    tcdrain(fd);
+    return static_cast<std::size_t>(sent);
+}
+} // namespace cpp_bindings_linux::detail
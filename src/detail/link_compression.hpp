@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cpp_bindings_linux/serial_error.hpp>
+
+#include "lz_stream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cpp_bindings_linux::detail
+{
+// Compressed-stream mode of a handle (serialSetCompression()).
+//
+// Every serialWrite() is cut into blocks of up to kLzMaxBlockSize bytes and each block travels as one frame:
+//
+//   kind (1) | raw size (2, LE) | payload size (2, LE) | payload | CRC-16/CCITT of the raw bytes (2, BE)
+//
+// kind is kFrameCompressed, or kFrameStored when compression would not make the block smaller. Both kinds feed
+// the shared history, so the dictionary keeps growing across writes. A frame that fails to parse, decode or match
+// its CRC means the two ends no longer agree on the history; the read side reports it and starts over, and both
+// ends have to re-enable the mode to resynchronize.
+inline constexpr unsigned char kFrameStored = 0xC0;
+inline constexpr unsigned char kFrameCompressed = 0xC1;
+inline constexpr int kFrameHeaderSize = 5;
+inline constexpr int kFrameTrailerSize = 2;
+
+// Read-side state, guarded by the read-side mutex. The buffers are reserved up front and only ever cleared, so
+// reads in steady state do not allocate.
+struct CompressedReader
+{
+    CompressedReader();
+
+    LzDecoder decoder;
+    std::vector<unsigned char> wire;    // received bytes that do not form a complete frame yet
+    std::vector<unsigned char> decoded; // decoded bytes not handed out yet, starting at decoded_offset
+    std::size_t decoded_offset = 0;
+    uint64_t raw_bytes = 0;
+    uint64_t wire_bytes = 0;
+};
+
+// Write-side state, guarded by the write-side mutex. frame is reserved for the largest possible frame.
+struct CompressedWriter
+{
+    CompressedWriter();
+
+    LzEncoder encoder;
+    std::vector<unsigned char> frame;
+    uint64_t raw_bytes = 0;
+    uint64_t wire_bytes = 0;
+};
+
+// Encodes one block (1..kLzMaxBlockSize bytes) into writer.frame.
+auto encodeFrame(CompressedWriter &writer, const unsigned char *data, int size) -> void;
+
+// Decodes every complete frame in reader.wire into reader.decoded. Fails (and resets the reader) on a corrupt frame.
+auto decodeFrames(CompressedReader &reader) -> SerialResult<void>;
+
+// serialRead() in compressed mode: returns decoded bytes, waiting at most timeout_ns for a complete frame.
+auto compressedRead(int fd, CompressedReader &reader, unsigned char *buffer, int buffer_size, int64_t timeout_ns)
+    -> SerialResult<std::size_t>;
+
+// serialWrite() in compressed mode. Frames are never cut short: once a frame is started it is written completely,
+// and the timeout only decides whether the next one is started. Returns the raw bytes sent.
+auto compressedWrite(int fd, CompressedWriter &writer, const unsigned char *data, int size, int64_t timeout_ns)
+    -> SerialResult<std::size_t>;
+} // namespace cpp_bindings_linux::detail
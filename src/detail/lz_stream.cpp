@@ -0,0 +1,228 @@
+#include "lz_stream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace cpp_bindings_linux::detail
+{
+namespace
+{
+constexpr int kMinMatch = 4;
+constexpr int kNibbleMax = 15;
+
+auto load32(const unsigned char *data) -> uint32_t
+{
+    uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+auto writeLength(unsigned char *&out, int length) -> void
+{
+    while (length >= 255)
+    {
+        *out++ = 255;
+        length -= 255;
+    }
+    *out++ = static_cast<unsigned char>(length);
+}
+
+auto readLength(const unsigned char *&in, const unsigned char *end, int &length) -> bool
+{
+    unsigned char byte = 255;
+    while (byte == 255)
+    {
+        if (in == end || length > kLzMaxBlockSize)
+        {
+            return false;
+        }
+        byte = *in++;
+        length += byte;
+    }
+    return true;
+}
+
+// One sequence: literals, then (unless it is the last sequence of the block) a match.
+auto emitSequence(unsigned char *&out, const unsigned char *literals, int literal_length, int offset,
+                  int match_length) -> void
+{
+    const int match_code = match_length > 0 ? match_length - kMinMatch : 0;
+    *out++ = static_cast<unsigned char>((std::min(literal_length, kNibbleMax) << 4) | std::min(match_code, kNibbleMax));
+    if (literal_length >= kNibbleMax)
+    {
+        writeLength(out, literal_length - kNibbleMax);
+    }
+    std::memcpy(out, literals, static_cast<std::size_t>(literal_length));
+    out += literal_length;
+
+    if (match_length == 0)
+    {
+        return;
+    }
+    *out++ = static_cast<unsigned char>(offset & 0xFF);
+    *out++ = static_cast<unsigned char>(offset >> 8);
+    if (match_code >= kNibbleMax)
+    {
+        writeLength(out, match_code - kNibbleMax);
+    }
+}
+} // namespace
+
+LzEncoder::LzEncoder()
+{
+    buffer_.reserve(kLzWindowSize + kLzMaxBlockSize);
+    reset();
+}
+
+auto LzEncoder::reset() -> void
+{
+    buffer_.clear();
+    table_.fill(-1);
+}
+
+auto LzEncoder::compress(const unsigned char *data, int size, unsigned char *out) -> int
+{
+    const int begin = static_cast<int>(buffer_.size());
+    buffer_.insert(buffer_.end(), data, data + size);
+    const unsigned char *base = buffer_.data();
+    const int end = begin + size;
+
+    const auto hashAt = [base](int position) {
+        return static_cast<std::size_t>((load32(base + position) * 2654435761U) >> (32 - kHashBits));
+    };
+
+    unsigned char *const out_begin = out;
+    int anchor = begin;
+    int position = begin;
+    while (position + kMinMatch <= end)
+    {
+        const std::size_t hash = hashAt(position);
+        const int candidate = table_[hash];
+        table_[hash] = position;
+        if (candidate < 0 || position - candidate > kLzWindowSize ||
+            load32(base + candidate) != load32(base + position))
+        {
+            ++position;
+            continue;
+        }
+
+        int length = kMinMatch;
+        while (position + length < end && base[candidate + length] == base[position + length])
+        {
+            ++length;
+        }
+        emitSequence(out, base + anchor, position - anchor, position - candidate, length);
+
+        // Index the matched bytes too, so the next records can refer to any part of this one.
+        for (int inner = position + 1; inner < position + length && inner + kMinMatch <= end; ++inner)
+        {
+            table_[hashAt(inner)] = inner;
+        }
+        position += length;
+        anchor = position;
+    }
+    emitSequence(out, base + anchor, end - anchor, 0, 0);
+
+    if (static_cast<int>(buffer_.size()) > kLzWindowSize)
+    {
+        const int shift = static_cast<int>(buffer_.size()) - kLzWindowSize;
+        buffer_.erase(buffer_.begin(), buffer_.begin() + shift);
+        for (auto &entry : table_)
+        {
+            entry = entry >= shift ? entry - shift : -1;
+        }
+    }
+    return static_cast<int>(out - out_begin);
+}
+
+LzDecoder::LzDecoder()
+{
+    history_.reserve(kLzWindowSize + kLzMaxBlockSize);
+}
+
+auto LzDecoder::reset() -> void
+{
+    history_.clear();
+}
+
+auto LzDecoder::trimHistory() -> void
+{
+    if (static_cast<int>(history_.size()) > kLzWindowSize)
+    {
+        history_.erase(history_.begin(), history_.end() - kLzWindowSize);
+    }
+}
+
+auto LzDecoder::appendStored(const unsigned char *data, int size) -> void
+{
+    history_.insert(history_.end(), data, data + size);
+    trimHistory();
+}
+
+auto LzDecoder::decompress(const unsigned char *in, int in_size, int raw_size, unsigned char *out) -> bool
+{
+    const std::size_t begin = history_.size();
+    history_.resize(begin + static_cast<std::size_t>(raw_size));
+    unsigned char *const output = history_.data();
+    std::size_t position = begin;
+    const std::size_t end = begin + static_cast<std::size_t>(raw_size);
+
+    const unsigned char *in_end = in + in_size;
+    while (true)
+    {
+        if (in == in_end)
+        {
+            return false;
+        }
+        const unsigned char token = *in++;
+
+        int literal_length = token >> 4;
+        if (literal_length == kNibbleMax && !readLength(in, in_end, literal_length))
+        {
+            return false;
+        }
+        if (literal_length > in_end - in || static_cast<std::size_t>(literal_length) > end - position)
+        {
+            return false;
+        }
+        std::memcpy(output + position, in, static_cast<std::size_t>(literal_length));
+        in += literal_length;
+        position += static_cast<std::size_t>(literal_length);
+
+        if (in == in_end)
+        {
+            break; // the last sequence carries literals only
+        }
+
+        if (in_end - in < 2)
+        {
+            return false;
+        }
+        const std::size_t offset = in[0] | (static_cast<std::size_t>(in[1]) << 8);
+        in += 2;
+        int match_length = token & kNibbleMax;
+        if (match_length == kNibbleMax && !readLength(in, in_end, match_length))
+        {
+            return false;
+        }
+        match_length += kMinMatch;
+        if (offset == 0 || offset > position || static_cast<std::size_t>(match_length) > end - position)
+        {
+            return false;
+        }
+        // Byte by byte: a match may overlap the bytes it produces (runs).
+        for (int i = 0; i < match_length; ++i, ++position)
+        {
+            output[position] = output[position - offset];
+        }
+    }
+
+    if (position != end)
+    {
+        return false;
+    }
+    std::memcpy(out, output + begin, static_cast<std::size_t>(raw_size));
+    trimHistory();
+    return true;
+}
+} // namespace cpp_bindings_linux::detail
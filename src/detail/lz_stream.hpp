@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace cpp_bindings_linux::detail
+{
+// LZ77 block codec using the LZ4 sequence format (token, literals, 16-bit offset, extended lengths).
+//
+// Unlike plain LZ4 blocks, the history is carried from one block to the next (a streaming dictionary): a match may
+// reach up to kLzWindowSize bytes back into earlier blocks. Small, repetitive telemetry records therefore compress
+// well even though each one is sent as its own block. Encoder and decoder must see the same blocks in the same
+// order; reset both ends together.
+
+// How far back a match may reach.
+inline constexpr int kLzWindowSize = 16 * 1024;
+
+// Largest block accepted by LzEncoder::compress().
+inline constexpr int kLzMaxBlockSize = 4096;
+
+// Room needed for the compressed form of a block of size bytes, incompressible input included.
+constexpr auto lzCompressBound(int size) -> int
+{
+    return size + (size / 255) + 16;
+}
+
+class LzEncoder
+{
+  public:
+    LzEncoder();
+
+    // Compresses one block of 1..kLzMaxBlockSize bytes into out (room for lzCompressBound(size) bytes) and adds
+    // it to the history. Returns the compressed size.
+    auto compress(const unsigned char *data, int size, unsigned char *out) -> int;
+
+    auto reset() -> void;
+
+  private:
+    static constexpr int kHashBits = 12;
+
+    std::vector<unsigned char> buffer_; // history (at most kLzWindowSize bytes), then the block being compressed
+    std::array<int32_t, std::size_t{1} << kHashBits> table_{}; // last position of each 4-byte hash, -1 if none
+};
+
+class LzDecoder
+{
+  public:
+    LzDecoder();
+
+    // Decodes one block into out (room for raw_size bytes) and adds it to the history. Returns false if the input
+    // is malformed or does not decode to exactly raw_size bytes; the history is then unusable until reset().
+    auto decompress(const unsigned char *in, int in_size, int raw_size, unsigned char *out) -> bool;
+
+    // Adds a block that was sent uncompressed to the history.
+    auto appendStored(const unsigned char *data, int size) -> void;
+
+    auto reset() -> void;
+
+  private:
+    auto trimHistory() -> void;
+
+    std::vector<unsigned char> history_;
+};
+} // namespace cpp_bindings_linux::detail
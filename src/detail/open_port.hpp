@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cpp_bindings_linux/serial_port.hpp>
+
+#include "port_registry.hpp"
+
+#include <memory>
+
+namespace cpp_bindings_linux::detail
+{
+// Opens and configures a port, then registers its per-handle state. Shared by serialOpen() and
+// serialOpenBatch(); safe to call from several threads at once.
+inline auto openRegisteredPort(const char *path, int baudrate, int data_bits, int parity, int stop_bits)
+    -> SerialResult<int>
+{
+    auto opened = SerialPort::open(path, SerialOptions{baudrate, data_bits, static_cast<Parity>(parity), stop_bits});
+    if (!opened)
+    {
+        return std::unexpected(opened.error());
+    }
+
+    PortRegistry::instance().add(opened->nativeHandle(),
+                                 std::make_unique<PortState>(PortConfig{path, baudrate, data_bits, parity, stop_bits}));
+    return opened->release();
+}
+} // namespace cpp_bindings_linux::detail
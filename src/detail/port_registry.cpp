@@ -0,0 +1,49 @@
+#include "port_registry.hpp"
+
+namespace cpp_bindings_linux::detail
+{
+auto PortRegistry::instance() -> PortRegistry &
+{
+    // Intentionally leaked: handles may still be used by other threads while static destructors run.
+    static auto *registry = new PortRegistry();
+    return *registry;
+}
+
+auto PortRegistry::add(int fd, std::unique_ptr<PortState> state) -> void
+{
+    if (fd < 0 || fd >= kMaxFds)
+    {
+        return;
+    }
+
+    const std::scoped_lock lock(mutex_);
+    auto &page_slot = pages_[static_cast<std::size_t>(fd) / kPageSize];
+    Page *page = page_slot.load(std::memory_order_relaxed);
+    if (page == nullptr)
+    {
+        // Pages are never freed, so lock-free readers can always dereference a published page.
+        page = new Page();
+        page_slot.store(page, std::memory_order_release);
+    }
+
+    const std::unique_ptr<PortState> stale(
+        page->slots[static_cast<std::size_t>(fd) % kPageSize].exchange(state.release(), std::memory_order_acq_rel));
+}
+
+auto PortRegistry::remove(int fd) -> std::unique_ptr<PortState>
+{
+    if (fd < 0 || fd >= kMaxFds)
+    {
+        return nullptr;
+    }
+
+    const std::scoped_lock lock(mutex_);
+    Page *page = pages_[static_cast<std::size_t>(fd) / kPageSize].load(std::memory_order_relaxed);
+    if (page == nullptr)
+    {
+        return nullptr;
+    }
+    return std::unique_ptr<PortState>(
+        page->slots[static_cast<std::size_t>(fd) % kPageSize].exchange(nullptr, std::memory_order_acq_rel));
+}
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,277 @@
+#pragma once
+
+#include "link_compression.hpp"
+#include "posix_helpers.hpp"
+#include "read_fanout.hpp"
+#include "write_pacer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace cpp_bindings_linux::detail
+{
+// Settings a port was opened with (as passed to serialOpen()).
+struct PortConfig
+{
+    std::string path;
+    int baudrate = 0;
+    int data_bits = 8;
+    int parity = 0;
+    int stop_bits = 1;
+
+    // Bits on the wire per character: start + data + parity + stop.
+    [[nodiscard]] auto bitsPerCharacter() const -> int
+    {
+        return 1 + data_bits + (parity != 0 ? 1 : 0) + (stop_bits == 2 ? 2 : 1);
+    }
+
+    // Time the UART needs to shift out one character at the configured baud rate.
+    [[nodiscard]] auto nsPerByte() const -> int64_t
+    {
+        return baudrate > 0 ? (static_cast<int64_t>(bitsPerCharacter()) * 1'000'000'000) / baudrate : 0;
+    }
+};
+
+// Bytes serialTransact() read past the end of its last reply. They are the oldest received input, so the next
+// read-side call hands them out before it reads the port. One transaction read() never returns more than kCapacity
+// bytes, and nothing is kept while earlier bytes are still waiting here.
+struct ReadCarry
+{
+    static constexpr int kCapacity = 4096;
+
+    std::array<unsigned char, kCapacity> bytes{};
+    int offset = 0;
+    int size = 0;
+    int64_t received_ns = 0; // CLOCK_MONOTONIC time of the read() that delivered them
+};
+
+// State owned by the receive direction. Only read-side operations touch it.
+struct alignas(64) ReadSide
+{
+    std::mutex mutex; // serializes read-side operations on one handle
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> calls{0};
+    std::unique_ptr<CompressedReader> compression; // set in compressed-stream mode
+    std::atomic<int64_t> busy_poll_ns{0};          // spin budget of serialSetBusyPoll(); 0 = always block
+    std::unique_ptr<FanoutBuffer> fanout;          // set in fan-out mode
+    ReadCarry carry;                               // guarded by mutex
+};
+
+// State owned by the transmit direction. Only write-side operations touch it.
+struct alignas(64) WriteSide
+{
+    std::mutex mutex; // serializes write-side operations on one handle
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> calls{0};
+    std::atomic<int> output_low_water{0}; // threshold for serialWaitOutputLowWater()
+    std::unique_ptr<CompressedWriter> compression; // set in compressed-stream mode
+    std::unique_ptr<PacedQueue> pacing;            // set in paced-write mode
+};
+
+// Per-handle state for ports opened through serialOpen().
+//
+// Concurrency model:
+//  - Read-side and write-side state are disjoint and sit on separate cache lines, each with its own mutex.
+//    One thread reading and another writing the same handle therefore never wait on each other.
+//  - Several threads on the same side are serialized by that side's mutex, one operation at a time.
+//  - Closing a handle must not overlap any other operation on it (the same rule POSIX has for file descriptors).
+struct PortState
+{
+    explicit PortState(PortConfig in_config) : config(std::move(in_config))
+    {
+    }
+
+    const PortConfig config;
+    ReadSide read;
+    WriteSide write;
+    std::atomic<bool> reconnect{false}; // set while the reconnect supervisor watches this port
+    std::atomic<bool> paced{false};     // set while the write pacer feeds this port
+    std::atomic<bool> fanout{false};    // set while the fan-out reader reads this port
+    std::atomic<bool> bridged{false};   // set once a bridge was started on this port
+};
+
+// Maps handles (file descriptors) to their PortState.
+//
+// Lookups are lock-free (two acquire loads), so the hot path never takes a registry-wide lock. add() and remove()
+// are serialized internally. Descriptors that were not opened through serialOpen() simply have no state.
+class PortRegistry
+{
+  public:
+    static auto instance() -> PortRegistry &;
+
+    // Installs state for fd, replacing (and destroying) any stale entry.
+    auto add(int fd, std::unique_ptr<PortState> state) -> void;
+
+    // Detaches the state of fd; the caller decides when to destroy it.
+    auto remove(int fd) -> std::unique_ptr<PortState>;
+
+    [[nodiscard]] auto find(int fd) const -> PortState *
+    {
+        if (fd < 0 || fd >= kMaxFds)
+        {
+            return nullptr;
+        }
+        const Page *page = pages_[static_cast<std::size_t>(fd) / kPageSize].load(std::memory_order_acquire);
+        if (page == nullptr)
+        {
+            return nullptr;
+        }
+        return page->slots[static_cast<std::size_t>(fd) % kPageSize].load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr std::size_t kPageSize = 1024;
+    static constexpr std::size_t kPageCount = 1024;
+    static constexpr int kMaxFds = static_cast<int>(kPageSize * kPageCount);
+
+    struct Page
+    {
+        std::array<std::atomic<PortState *>, kPageSize> slots{};
+    };
+
+    PortRegistry() = default;
+
+    std::array<std::atomic<Page *>, kPageCount> pages_{};
+    std::mutex mutex_;
+};
+
+// Looks up the state of a handle opened with serialOpen(). Returns nullptr after reporting kInvalidHandleError
+// through error_callback when the handle is out of range or unknown.
+template <typename Callback>
+[[nodiscard]] inline auto findRegisteredPort(int64_t handle, Callback error_callback) -> PortState *
+{
+    if (handle <= 0 || handle > std::numeric_limits<int>::max())
+    {
+        invokeErrorCallback(error_callback, cpp_core::StatusCodes::kInvalidHandleError, "Invalid handle");
+        return nullptr;
+    }
+    PortState *state = PortRegistry::instance().find(static_cast<int>(handle));
+    if (state == nullptr)
+    {
+        invokeErrorCallback(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                            "Handle was not opened with serialOpen");
+    }
+    return state;
+}
+
+// Locks one side of a port for the duration of an operation; no-op for descriptors without state.
+[[nodiscard]] inline auto lockReadSide(PortState *state) -> std::unique_lock<std::mutex>
+{
+    return state != nullptr ? std::unique_lock<std::mutex>(state->read.mutex) : std::unique_lock<std::mutex>();
+}
+
+[[nodiscard]] inline auto lockWriteSide(PortState *state) -> std::unique_lock<std::mutex>
+{
+    return state != nullptr ? std::unique_lock<std::mutex>(state->write.mutex) : std::unique_lock<std::mutex>();
+}
+
+// In fan-out mode the fan-out reader owns the received byte stream; any other read would take bytes away from the
+// subscribers. Returns true after reporting kReadError through error_callback. Call it with the read-side lock held.
+template <typename Callback>
+[[nodiscard]] inline auto rejectFanoutRead(const PortState *state, Callback error_callback) -> bool
+{
+    if (state == nullptr || state->read.fanout == nullptr)
+    {
+        return false;
+    }
+    invokeErrorCallback(error_callback, cpp_core::StatusCodes::kReadError,
+                        "Handle is in fan-out mode; use serialFanoutRead");
+    return true;
+}
+
+// Compressed-stream mode is translated by serialRead(), serialWrite() and serialWriteAll() only. Calls that work on
+// the raw wire bytes use these to fail instead of mixing unframed bytes into the stream; both return true after
+// reporting the conflict through error_callback. Call them with the side lock held.
+template <typename Callback>
+[[nodiscard]] inline auto rejectCompressedRead(const PortState *state, Callback error_callback) -> bool
+{
+    if (state == nullptr || state->read.compression == nullptr)
+    {
+        return false;
+    }
+    invokeErrorCallback(error_callback, cpp_core::StatusCodes::kReadError,
+                        "Handle is in compressed-stream mode; use serialRead");
+    return true;
+}
+
+template <typename Callback>
+[[nodiscard]] inline auto rejectCompressedWrite(const PortState *state, Callback error_callback) -> bool
+{
+    if (state == nullptr || state->write.compression == nullptr)
+    {
+        return false;
+    }
+    invokeErrorCallback(error_callback, cpp_core::StatusCodes::kWriteError,
+                        "Handle is in compressed-stream mode; use serialWrite");
+    return true;
+}
+
+// Copies up to buffer_size kept bytes (see ReadCarry) and removes them. Returns the number copied, 0 when nothing is
+// kept. Call it with the read-side lock held.
+inline auto takeCarried(PortState *state, void *buffer, int buffer_size) -> int
+{
+    if (state == nullptr || state->read.carry.size == 0)
+    {
+        return 0;
+    }
+    ReadCarry &carry = state->read.carry;
+    const int count = std::min(carry.size, buffer_size);
+    std::memcpy(buffer, carry.bytes.data() + carry.offset, static_cast<std::size_t>(count));
+    carry.offset = count == carry.size ? 0 : carry.offset + count;
+    carry.size -= count;
+    return count;
+}
+
+// Replaces the kept bytes; size must not exceed ReadCarry::kCapacity. Call it with the read-side lock held.
+inline auto keepCarried(PortState &state, const unsigned char *data, int size, int64_t received_ns) -> void
+{
+    ReadCarry &carry = state.read.carry;
+    std::memcpy(carry.bytes.data(), data, static_cast<std::size_t>(size));
+    carry.offset = 0;
+    carry.size = size;
+    carry.received_ns = received_ns;
+}
+
+inline auto dropCarried(PortState *state) -> void
+{
+    if (state != nullptr)
+    {
+        state->read.carry.offset = 0;
+        state->read.carry.size = 0;
+    }
+}
+
+// Statistics helpers; relaxed atomics because readers of the stats only need eventually consistent totals.
+inline auto recordRead(PortState *state, int64_t bytes) -> void
+{
+    if (state == nullptr)
+    {
+        return;
+    }
+    state->read.calls.fetch_add(1, std::memory_order_relaxed);
+    if (bytes > 0)
+    {
+        state->read.bytes.fetch_add(static_cast<uint64_t>(bytes), std::memory_order_relaxed);
+    }
+}
+
+inline auto recordWrite(PortState *state, int64_t bytes) -> void
+{
+    if (state == nullptr)
+    {
+        return;
+    }
+    state->write.calls.fetch_add(1, std::memory_order_relaxed);
+    if (bytes > 0)
+    {
+        state->write.bytes.fetch_add(static_cast<uint64_t>(bytes), std::memory_order_relaxed);
+    }
+}
+} // namespace cpp_bindings_linux::detail
@@ -1,79 +1,34 @@
 #pragma once
 
+#include <cpp_bindings_linux/detail/unique_fd.hpp>
+#include <cpp_bindings_linux/serial_error.hpp>
 #include <cpp_core/status_codes.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <limits>
 #include <poll.h>
-#include <string>
-#include <system_error>
+#include <sys/types.h>
+#include <type_traits>
 #include <unistd.h>
 
 namespace cpp_bindings_linux::detail
 {
-class UniqueFd
-{
-  public:
-    UniqueFd() = default;
-    explicit UniqueFd(int in_fd) : fd_(in_fd)
-    {
-    }
-
-    UniqueFd(const UniqueFd &) = delete;
-    auto operator=(const UniqueFd &) -> UniqueFd & = delete;
-
-    UniqueFd(UniqueFd &&other) noexcept : fd_(other.fd_)
-    {
-        other.fd_ = -1;
-    }
-    auto operator=(UniqueFd &&other) noexcept -> UniqueFd &
-    {
-        if (this != &other)
-        {
-            reset(other.release());
-        }
-        return *this;
-    }
-
-    ~UniqueFd()
-    {
-        reset(-1);
-    }
-
-    [[nodiscard]] auto get() const -> int
-    {
-        return fd_;
-    }
-    [[nodiscard]] auto valid() const -> bool
-    {
-        return fd_ >= 0;
-    }
-
-    auto reset(int new_fd) -> void
-    {
-        if (fd_ >= 0)
-        {
-            close(fd_);
-        }
-        fd_ = new_fd;
-    }
-
-    [[nodiscard]] auto release() -> int
-    {
-        const int out = fd_;
-        fd_ = -1;
-        return out;
-    }
-
-  private:
-    int fd_ = -1;
-};
-
+// Callback may also be std::nullptr_t, for internal callers that have nobody to report to.
 template <typename Callback>
 inline auto invokeErrorCallback(Callback error_callback, cpp_core::StatusCodes code, const char *message) -> void
 {
-    if (error_callback != nullptr)
+    if constexpr (!std::is_null_pointer_v<Callback>)
     {
-        error_callback(static_cast<int>(code), message);
+        if (error_callback != nullptr)
+        {
+            error_callback(static_cast<int>(code), message);
+        }
     }
 }
 
@@ -84,27 +39,52 @@ inline auto failMsg(Callback error_callback, cpp_core::StatusCodes code, const c
     return static_cast<Ret>(code);
 }
 
+// strerror_r() comes in two flavours: XSI returns a status and fills the buffer, GNU returns the text (which may
+// or may not be in the buffer). Overloading on the return type picks whichever the C library declares.
+inline auto strerrorText(int result, const char *buffer) -> const char *
+{
+    return result == 0 ? buffer : "Unknown error";
+}
+
+inline auto strerrorText(const char *result, const char * /*buffer*/) -> const char *
+{
+    return result;
+}
+
+// Reports errno through the callback. The text is formatted into a stack buffer, so error paths do not allocate.
 template <typename Ret, typename Callback>
 inline auto failErrno(Callback error_callback, cpp_core::StatusCodes code) -> Ret
 {
     if (error_callback != nullptr)
     {
-        const std::string error_msg = std::error_code(errno, std::generic_category()).message();
-        error_callback(static_cast<int>(code), error_msg.c_str());
+        std::array<char, 128> buffer{};
+        const char *error_msg = strerrorText(strerror_r(errno, buffer.data(), buffer.size()), buffer.data());
+        error_callback(static_cast<int>(code), error_msg);
     }
     return static_cast<Ret>(code);
 }
 
-// Poll helper used by read/write to implement timeouts.
-// Returns: -1 on poll error, 0 on timeout/not-ready, 1 on ready.
-inline auto waitFdReady(int file_descriptor, int timeout_ms, bool for_read) -> int
+// Reports a C++ API failure through a C error callback, with the same text the C ABI always produced.
+template <typename Ret, typename Callback>
+inline auto failError(Callback error_callback, const SerialError &error) -> Ret
 {
-    struct pollfd poll_fd = {};
-    poll_fd.fd = file_descriptor;
-    poll_fd.events = for_read ? POLLIN : POLLOUT;
-    poll_fd.revents = 0;
+    if (error.message != nullptr)
+    {
+        return failMsg<Ret>(error_callback, error.code, error.message);
+    }
+    errno = error.error_number;
+    return failErrno<Ret>(error_callback, error.code);
+}
 
-    const int poll_result = poll(&poll_fd, 1, timeout_ms);
+// Poll helpers used by read/write to implement timeouts; readinessAfterPoll() interprets the poll()/ppoll() result.
+// Returns: -1 on error (errno is set), 0 on timeout, 1 on ready.
+//
+// A dead device is an error, not "not ready": otherwise a caller that waits again would spin on it, because
+// POLLHUP/POLLERR stay set and poll() returns at once. A hangup (e.g. an unplugged USB adapter) is reported with
+// errno ENODEV, an error condition on the device with EIO and a closed descriptor with EBADF. Data that is still
+// queued when the device hangs up is reported as ready first, so it can be drained.
+inline auto readinessAfterPoll(int poll_result, const struct pollfd &poll_fd, bool for_read) -> int
+{
     if (poll_result < 0)
     {
         return -1;
@@ -113,14 +93,139 @@ inline auto waitFdReady(int file_descriptor, int timeout_ms, bool for_read) -> i
     {
         return 0;
     }
+    if ((poll_fd.revents & POLLNVAL) != 0)
+    {
+        errno = EBADF;
+        return -1;
+    }
     if (for_read && ((poll_fd.revents & POLLIN) != 0))
     {
         return 1;
     }
+    if ((poll_fd.revents & POLLHUP) != 0)
+    {
+        errno = ENODEV;
+        return -1;
+    }
+    if ((poll_fd.revents & POLLERR) != 0)
+    {
+        errno = EIO;
+        return -1;
+    }
     if (!for_read && ((poll_fd.revents & POLLOUT) != 0))
     {
         return 1;
     }
     return 0;
 }
+
+inline auto waitFdReady(int file_descriptor, int timeout_ms, bool for_read) -> int
+{
+    struct pollfd poll_fd = {file_descriptor, static_cast<short>(for_read ? POLLIN : POLLOUT), 0};
+    return readinessAfterPoll(poll(&poll_fd, 1, timeout_ms), poll_fd, for_read);
+}
+
+// waitFdReady() with a nanosecond timeout (ppoll()), for links fast enough that a millisecond is several frames.
+// The kernel measures the timeout on CLOCK_MONOTONIC; callers that wait repeatedly pass what is left of a
+// Deadline, so retries do not accumulate rounding.
+inline auto waitFdReadyNs(int file_descriptor, int64_t timeout_ns, bool for_read) -> int
+{
+    struct pollfd poll_fd = {file_descriptor, static_cast<short>(for_read ? POLLIN : POLLOUT), 0};
+    timeout_ns = std::max<int64_t>(timeout_ns, 0);
+    const struct timespec timeout = {static_cast<time_t>(timeout_ns / 1'000'000'000),
+                                     static_cast<long>(timeout_ns % 1'000'000'000)};
+    return readinessAfterPoll(ppoll(&poll_fd, 1, &timeout, nullptr), poll_fd, for_read);
+}
+
+// CLOCK_MONOTONIC in nanoseconds. Served from the vDSO, so it does not cost a syscall.
+inline auto monotonicNowNs() -> int64_t
+{
+    struct timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<int64_t>(now.tv_sec) * 1'000'000'000) + now.tv_nsec;
+}
+
+// Converts a C++ API timeout to poll() milliseconds: negative becomes 0, huge values are capped at INT_MAX (~24 days).
+inline auto toTimeoutMs(std::chrono::milliseconds timeout) -> int
+{
+    return static_cast<int>(
+        std::clamp<std::chrono::milliseconds::rep>(timeout.count(), 0, std::numeric_limits<int>::max()));
+}
+
+// Converts a C++ API timeout to nanoseconds for waitFdReadyNs(): negative becomes 0.
+inline auto toTimeoutNs(std::chrono::nanoseconds timeout) -> int64_t
+{
+    return std::max<std::chrono::nanoseconds::rep>(timeout.count(), 0);
+}
+
+// Absolute CLOCK_MONOTONIC deadline, so several waits inside one call share a single overall timeout.
+class Deadline
+{
+  public:
+    explicit Deadline(int timeout_ms) : end_ns_(monotonicNowNs() + (static_cast<int64_t>(timeout_ms) * 1'000'000))
+    {
+    }
+
+    [[nodiscard]] static auto afterNs(int64_t timeout_ns) -> Deadline
+    {
+        Deadline deadline(0);
+        deadline.end_ns_ += timeout_ns;
+        return deadline;
+    }
+
+    // Nanoseconds left; 0 once the deadline has passed.
+    [[nodiscard]] auto remainingNs() const -> int64_t
+    {
+        return std::max<int64_t>(end_ns_ - monotonicNowNs(), 0);
+    }
+
+    // Milliseconds left, rounded up so a wait never ends before the deadline; 0 once it has passed.
+    [[nodiscard]] auto remainingMs() const -> int
+    {
+        const int64_t remaining_ns = end_ns_ - monotonicNowNs();
+        if (remaining_ns <= 0)
+        {
+            return 0;
+        }
+        return static_cast<int>((remaining_ns + 999'999) / 1'000'000);
+    }
+
+  private:
+    int64_t end_ns_;
+};
+
+// Single non-blocking read. EAGAIN/EWOULDBLOCK is reported as 0 bytes, other errors as -1 (errno is preserved).
+inline auto readNonBlocking(int file_descriptor, void *buffer, int buffer_size) -> ssize_t
+{
+    const ssize_t bytes = ::read(file_descriptor, buffer, static_cast<size_t>(buffer_size));
+    if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        return 0;
+    }
+    return bytes;
+}
+
+// Single non-blocking read after poll() reported the descriptor readable. Nothing to read at that point is
+// end-of-file; if the device has hung up, that is reported as -1 with errno ENODEV, like waitFdReady() does,
+// instead of as 0 bytes, which callers would take for a timeout and retry forever. Plain end-of-file (/dev/null)
+// stays 0. The extra hangup check only runs on the 0-byte path.
+inline auto readAfterReady(int file_descriptor, void *buffer, int buffer_size) -> ssize_t
+{
+    const ssize_t bytes = ::read(file_descriptor, buffer, static_cast<size_t>(buffer_size));
+    if (bytes == 0)
+    {
+        struct pollfd poll_fd = {file_descriptor, 0, 0};
+        if (poll(&poll_fd, 1, 0) > 0 && (poll_fd.revents & POLLHUP) != 0)
+        {
+            errno = ENODEV;
+            return -1;
+        }
+        return 0;
+    }
+    if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        return 0;
+    }
+    return bytes;
+}
 } // namespace cpp_bindings_linux::detail
@@ -0,0 +1,224 @@
+#include "read_fanout.hpp"
+
+#include <cpp_core/status_codes.h>
+
+#include "port_registry.hpp"
+#include "thread_tuning.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace cpp_bindings_linux::detail
+{
+namespace
+{
+// Bytes taken from a port per wakeup; poll() reports the port again right away if more is waiting.
+constexpr std::size_t kPumpChunkSize = 4096;
+
+auto drain(int fd) -> void
+{
+    uint64_t value = 0;
+    (void)read(fd, &value, sizeof(value));
+}
+} // namespace
+
+auto FanoutBuffer::freeSpace() const -> std::size_t
+{
+    uint64_t oldest = head;
+    for (const auto &[subscriber, cursor] : cursors)
+    {
+        oldest = std::min(oldest, cursor.position);
+    }
+    return ring.size() - static_cast<std::size_t>(head - oldest);
+}
+
+auto FanoutBuffer::append(const unsigned char *data, std::size_t count) -> void
+{
+    const std::size_t capacity = ring.size();
+    const uint64_t new_head = head + count;
+    for (auto &[subscriber, cursor] : cursors)
+    {
+        if (new_head - cursor.position > capacity)
+        {
+            const uint64_t skipped = new_head - capacity - cursor.position;
+            cursor.position += skipped;
+            cursor.dropped += skipped;
+        }
+    }
+
+    // Only the newest capacity bytes can still be reached by any cursor.
+    const std::size_t kept = std::min(count, capacity);
+    data += count - kept;
+    const auto start = static_cast<std::size_t>((new_head - kept) % capacity);
+    const std::size_t first = std::min(kept, capacity - start);
+    std::memcpy(ring.data() + start, data, first);
+    std::memcpy(ring.data(), data + first, kept - first);
+    head = new_head;
+}
+
+auto FanoutBuffer::take(Cursor &cursor, unsigned char *out, std::size_t size) const -> std::size_t
+{
+    const std::size_t capacity = ring.size();
+    const std::size_t count = std::min(static_cast<std::size_t>(head - cursor.position), size);
+    const auto start = static_cast<std::size_t>(cursor.position % capacity);
+    const std::size_t first = std::min(count, capacity - start);
+    std::memcpy(out, ring.data() + start, first);
+    std::memcpy(out + first, ring.data(), count - first);
+    cursor.position += count;
+    return count;
+}
+
+auto pumpFanout(int fd, PortState &state, FanoutBuffer &buffer) -> void
+{
+    const std::size_t room = std::min(buffer.block ? buffer.freeSpace() : kPumpChunkSize, kPumpChunkSize);
+    if (room == 0 || buffer.error_number != 0)
+    {
+        return;
+    }
+
+    std::array<unsigned char, kPumpChunkSize> chunk{};
+    const ssize_t bytes = ::read(fd, chunk.data(), room);
+    if (bytes > 0)
+    {
+        buffer.append(chunk.data(), static_cast<std::size_t>(bytes));
+        recordRead(&state, bytes);
+        buffer.data.notify_all();
+    }
+    else if (bytes == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+    {
+        // poll() said the port was ready, so end-of-file here means the device went away.
+        buffer.error_number = bytes == 0 ? ENODEV : errno;
+        buffer.data.notify_all();
+    }
+}
+
+auto FanoutReader::instance() -> FanoutReader &
+{
+    // Intentionally leaked, like the port registry: the thread may outlive static destruction.
+    static auto *reader = new FanoutReader();
+    return *reader;
+}
+
+auto FanoutReader::add(int fd) -> SerialResult<void>
+{
+    const std::scoped_lock lock(mutex_);
+    if (!wake_fd_.valid())
+    {
+        wake_fd_.reset(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+        if (!wake_fd_.valid())
+        {
+            return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, errno, nullptr});
+        }
+    }
+
+    fds_.insert(fd);
+    if (thread_.joinable())
+    {
+        wake();
+        return {};
+    }
+    try
+    {
+        thread_ = std::jthread([this](const std::stop_token &stop) { run(stop); });
+    }
+    catch (const std::system_error &error)
+    {
+        fds_.erase(fd);
+        return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, error.code().value(), nullptr});
+    }
+    return {};
+}
+
+auto FanoutReader::remove(int fd) -> void
+{
+    std::jthread stopped;
+    {
+        const std::scoped_lock lock(mutex_);
+        if (fds_.erase(fd) == 0)
+        {
+            return;
+        }
+        if (fds_.empty())
+        {
+            thread_.request_stop();
+            stopped = std::move(thread_);
+        }
+        wake();
+    }
+    // Joined outside the lock, because the thread takes it once more on its way out.
+}
+
+auto FanoutReader::wake() const -> void
+{
+    const uint64_t one = 1;
+    (void)write(wake_fd_.get(), &one, sizeof(one));
+}
+
+auto FanoutReader::run(const std::stop_token &stop) -> void
+{
+    const TunedThreadScope tuned;
+    std::vector<struct pollfd> poll_fds;
+    while (!stop.stop_requested())
+    {
+        {
+            const std::scoped_lock lock(mutex_);
+            if (stop.stop_requested())
+            {
+                return;
+            }
+
+            poll_fds.clear();
+            poll_fds.push_back({wake_fd_.get(), POLLIN, 0});
+            for (const int fd : fds_)
+            {
+                PortState *state = PortRegistry::instance().find(fd);
+                if (state == nullptr)
+                {
+                    continue;
+                }
+                const std::scoped_lock side_lock(state->read.mutex);
+                const FanoutBuffer *buffer = state->read.fanout.get();
+                if (buffer != nullptr && buffer->error_number == 0 && (!buffer->block || buffer->freeSpace() > 0))
+                {
+                    poll_fds.push_back({fd, POLLIN, 0});
+                }
+            }
+        }
+
+        if (poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), -1) < 0 && errno != EINTR)
+        {
+            return;
+        }
+
+        const std::scoped_lock lock(mutex_);
+        if (stop.stop_requested())
+        {
+            return;
+        }
+        drain(wake_fd_.get());
+        for (std::size_t i = 1; i < poll_fds.size(); ++i)
+        {
+            const int fd = poll_fds[i].fd;
+            if (poll_fds[i].revents == 0 || !fds_.contains(fd))
+            {
+                continue;
+            }
+            PortState *state = PortRegistry::instance().find(fd);
+            if (state == nullptr)
+            {
+                continue;
+            }
+            const std::scoped_lock side_lock(state->read.mutex);
+            if (state->read.fanout != nullptr)
+            {
+                pumpFanout(fd, *state, *state->read.fanout);
+            }
+        }
+    }
+}
+} // namespace cpp_bindings_linux::detail
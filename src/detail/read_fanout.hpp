@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cpp_bindings_linux/detail/unique_fd.hpp>
+#include <cpp_bindings_linux/serial_error.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace cpp_bindings_linux::detail
+{
+struct PortState;
+
+// Shared receive buffer of a handle in fan-out mode (serialSetFanout()). Guarded by the read-side mutex.
+//
+// The fan-out thread appends everything the port delivers to one ring buffer; every subscriber has its own cursor
+// into it. Positions count bytes since the mode was enabled, so the byte at position p sits at p % capacity and a
+// cursor has head - position bytes waiting. With the drop policy a cursor that falls more than a buffer behind is
+// moved forward and the skipped bytes are counted; with the block policy the thread stops reading the port while
+// the slowest cursor is a full buffer behind, and the kernel queue (and flow control) takes over.
+struct FanoutBuffer
+{
+    struct Cursor
+    {
+        uint64_t position = 0;
+        uint64_t dropped = 0;
+    };
+
+    FanoutBuffer(std::size_t capacity, bool in_block) : block(in_block), ring(capacity)
+    {
+    }
+
+    // Room before the slowest cursor would be overrun.
+    [[nodiscard]] auto freeSpace() const -> std::size_t;
+
+    // Adds received bytes. Lagging cursors are moved forward (drop policy); the block policy never appends more
+    // than freeSpace().
+    auto append(const unsigned char *data, std::size_t count) -> void;
+
+    // Copies up to size waiting bytes for one cursor and advances it. Returns the number of bytes copied.
+    auto take(Cursor &cursor, unsigned char *out, std::size_t size) const -> std::size_t;
+
+    bool block;
+    std::vector<unsigned char> ring;
+    uint64_t head = 0; // position of the next byte to arrive
+    std::map<int64_t, Cursor> cursors;
+    int64_t next_subscriber = 1;
+
+    int error_number = 0;         // errno of a failed read by the fan-out thread; sticky, reported to everyone
+    std::condition_variable data; // signalled when bytes arrived (or the read failed, or the buffer goes away)
+};
+
+// Background thread that reads all handles in fan-out mode into their shared buffers.
+//
+// One poll() covers every such port plus an eventfd for changes, so the mode costs one thread in total. A port
+// whose block-policy buffer is full is left out of the poll set until a subscriber makes room and calls wake().
+// The thread exits once no handle is in fan-out mode any more.
+class FanoutReader
+{
+  public:
+    static auto instance() -> FanoutReader &;
+
+    auto add(int fd) -> SerialResult<void>;
+
+    // Once this returns the thread no longer touches the descriptor.
+    auto remove(int fd) -> void;
+
+    // A buffer changed or a blocked buffer got room: rebuild the poll set.
+    auto wake() const -> void;
+
+  private:
+    FanoutReader() = default;
+
+    auto run(const std::stop_token &stop) -> void;
+
+    std::mutex mutex_;
+    std::set<int> fds_;
+    UniqueFd wake_fd_;
+    std::jthread thread_;
+};
+
+// Moves whatever the port has into the buffer, within its free space. Called with the read-side mutex held.
+auto pumpFanout(int fd, PortState &state, FanoutBuffer &buffer) -> void;
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "posix_helpers.hpp"
+
+#include <algorithm>
+#include <sys/ioctl.h>
+#include <sys/types.h>
+
+namespace cpp_bindings_linux::detail
+{
+// Observer that ignores all read-loop events (plain serialRead()).
+struct NoReadObserver
+{
+    auto onReady() -> void
+    {
+    }
+    auto onChunk(int /*offset*/, int /*size*/) -> void
+    {
+    }
+};
+
+// Receive path shared by the serialRead() family; it performs at most one read().
+//
+//  - timeout == 0: FIONREAD tells whether anything is queued. An idle port costs a single ioctl(), a busy one
+//    ioctl() + read() sized to what is queued. Descriptors without FIONREAD fall back to the poll path.
+//  - timeout > 0: one ppoll() for readiness, then one read() of up to buffer_size bytes. A non-blocking read()
+//    already returns everything queued (up to buffer_size), so no extra sizing or draining syscalls are needed.
+//
+// The observer is told about the readiness wakeup (onReady) and the read() that delivered data (onChunk); both are
+// inlined, so the plain read path pays nothing for them.
+// Returns: bytes read, 0 on timeout, -1 on error (errno is preserved; ENODEV once the device has hung up).
+template <typename Observer>
+inline auto readWithTimeoutNs(int file_descriptor, unsigned char *buffer, int buffer_size, int64_t timeout_ns,
+                              Observer &observer) -> ssize_t
+{
+    int read_size = buffer_size;
+    int queued = 0;
+    if (timeout_ns <= 0 && ioctl(file_descriptor, FIONREAD, &queued) == 0)
+    {
+        if (queued <= 0)
+        {
+            return 0;
+        }
+        read_size = std::min(queued, buffer_size);
+    }
+    else
+    {
+        const int ready = waitFdReadyNs(file_descriptor, timeout_ns, true);
+        if (ready <= 0)
+        {
+            return ready;
+        }
+    }
+    observer.onReady();
+
+    const ssize_t bytes_read = readAfterReady(file_descriptor, buffer, read_size);
+    if (bytes_read > 0)
+    {
+        observer.onChunk(0, static_cast<int>(bytes_read));
+    }
+    return bytes_read;
+}
+
+// Busy-poll phase of a read (serialSetBusyPoll()): retries a non-blocking read() until data arrives or spin_ns has
+// passed, trading a core for the scheduler wakeup a ppoll() sleep costs. Returns bytes read, 0 when the budget ran
+// out (the caller then waits normally for the rest of its timeout), -1 on error. A hung-up device reads as empty
+// here and is reported by that wait.
+inline auto spinRead(int file_descriptor, unsigned char *buffer, int buffer_size, int64_t spin_ns) -> ssize_t
+{
+    const int64_t end_ns = monotonicNowNs() + spin_ns;
+    do
+    {
+        const ssize_t bytes = readNonBlocking(file_descriptor, buffer, buffer_size);
+        if (bytes != 0)
+        {
+            return bytes;
+        }
+    } while (monotonicNowNs() < end_ns);
+    return 0;
+}
+
+template <typename Observer>
+inline auto readWithTimeout(int file_descriptor, unsigned char *buffer, int buffer_size, int timeout_ms,
+                            Observer &observer) -> ssize_t
+{
+    return readWithTimeoutNs(file_descriptor, buffer, buffer_size, static_cast<int64_t>(timeout_ms) * 1'000'000,
+                             observer);
+}
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,296 @@
+#include "reconnect_supervisor.hpp"
+
+#include <cpp_bindings_linux/serial_port.hpp>
+#include <cpp_core/status_codes.h>
+
+#include "port_registry.hpp"
+#include "read_fanout.hpp"
+#include "thread_tuning.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace cpp_bindings_linux::detail
+{
+namespace
+{
+// udev publishes one symlink per USB-serial adapter here, named after vendor, product and serial number,
+// e.g. usb-FTDI_FT232R_USB_UART_A50285BI-if00-port0.
+constexpr const char *kSerialByIdDir = "/dev/serial/by-id";
+
+// A node appearing (or a rename into place), and udev fixing up its permissions afterwards.
+constexpr uint32_t kWatchMask = IN_CREATE | IN_MOVED_TO | IN_ATTRIB | IN_ONLYDIR;
+
+auto parentDirectory(const std::string &path) -> std::string
+{
+    const auto slash = path.find_last_of('/');
+    if (slash == std::string::npos)
+    {
+        return ".";
+    }
+    return slash == 0 ? "/" : path.substr(0, slash);
+}
+
+auto findBySerial(const std::string &usb_serial) -> std::string
+{
+    DIR *dir = opendir(kSerialByIdDir);
+    if (dir == nullptr)
+    {
+        return {};
+    }
+
+    const std::string needle = "_" + usb_serial + "-";
+    std::string found;
+    while (const struct dirent *entry = readdir(dir))
+    {
+        const std::string name = entry->d_name;
+        if (name.find(needle) != std::string::npos)
+        {
+            found = std::string(kSerialByIdDir) + "/" + name;
+            break;
+        }
+    }
+    closedir(dir);
+    return found;
+}
+
+auto drain(int fd) -> void
+{
+    alignas(struct inotify_event) std::array<char, 4096> buffer{};
+    while (read(fd, buffer.data(), buffer.size()) > 0)
+    {
+    }
+}
+} // namespace
+
+auto ReconnectSupervisor::instance() -> ReconnectSupervisor &
+{
+    // Intentionally leaked, like the port registry: the thread may outlive static destruction.
+    static auto *supervisor = new ReconnectSupervisor();
+    return *supervisor;
+}
+
+auto ReconnectSupervisor::add(int fd, std::string usb_serial) -> SerialResult<void>
+{
+    const std::scoped_lock lock(mutex_);
+    if (!wake_fd_.valid())
+    {
+        UniqueFd wake_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+        UniqueFd inotify_fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC));
+        if (!wake_fd.valid() || !inotify_fd.valid())
+        {
+            return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, errno, nullptr});
+        }
+        wake_fd_ = std::move(wake_fd);
+        inotify_fd_ = std::move(inotify_fd);
+    }
+
+    entries_[fd] = Entry{std::move(usb_serial), true};
+    if (thread_.joinable())
+    {
+        wake();
+        return {};
+    }
+    try
+    {
+        thread_ = std::jthread([this](const std::stop_token &stop) { run(stop); });
+    }
+    catch (const std::system_error &error)
+    {
+        entries_.erase(fd);
+        return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, error.code().value(), nullptr});
+    }
+    return {};
+}
+
+auto ReconnectSupervisor::remove(int fd) -> void
+{
+    std::jthread stopped;
+    {
+        const std::scoped_lock lock(mutex_);
+        if (entries_.erase(fd) == 0)
+        {
+            return;
+        }
+        if (entries_.empty())
+        {
+            // A later add() starts a fresh thread right away; this one only has to notice and leave.
+            thread_.request_stop();
+            stopped = std::move(thread_);
+            refreshWatches();
+        }
+        wake();
+    }
+    // Joined outside the lock, because the thread takes it once more on its way out.
+}
+
+auto ReconnectSupervisor::wake() const -> void
+{
+    const uint64_t one = 1;
+    (void)write(wake_fd_.get(), &one, sizeof(one));
+}
+
+auto ReconnectSupervisor::refreshWatches() -> void
+{
+    for (const int watch : watches_)
+    {
+        inotify_rm_watch(inotify_fd_.get(), watch);
+    }
+    watches_.clear();
+
+    for (const auto &[fd, entry] : entries_)
+    {
+        if (entry.connected)
+        {
+            continue;
+        }
+        const PortState *state = PortRegistry::instance().find(fd);
+        if (state == nullptr)
+        {
+            continue;
+        }
+
+        // Watch the directory the device will appear in or, while that does not exist either (udev removes
+        // /dev/serial/by-id with the last adapter), its closest existing ancestor; creating the missing level
+        // triggers another refresh.
+        std::string dir = entry.usb_serial.empty() ? parentDirectory(state->config.path) : kSerialByIdDir;
+        while (true)
+        {
+            const int watch = inotify_add_watch(inotify_fd_.get(), dir.c_str(), kWatchMask);
+            if (watch >= 0)
+            {
+                watches_.push_back(watch);
+                break;
+            }
+            if (errno != ENOENT || dir == "/" || dir == ".")
+            {
+                break;
+            }
+            dir = parentDirectory(dir);
+        }
+    }
+}
+
+auto ReconnectSupervisor::tryReconnect(int fd, Entry &entry) -> bool
+{
+    PortState *state = PortRegistry::instance().find(fd);
+    if (state == nullptr)
+    {
+        return false;
+    }
+
+    const std::string path = entry.usb_serial.empty() ? state->config.path : findBySerial(entry.usb_serial);
+    if (path.empty())
+    {
+        return false;
+    }
+
+    const PortConfig &config = state->config;
+    const auto reopened = SerialPort::open(
+        path, SerialOptions{config.baudrate, config.data_bits, static_cast<Parity>(config.parity), config.stop_bits});
+    if (!reopened)
+    {
+        // Not there yet, or udev has not granted access yet; the next inotify event retries.
+        return false;
+    }
+
+    {
+        // No read or write may straddle the old and the new device.
+        const std::scoped_lock side_locks(state->read.mutex, state->write.mutex);
+        if (dup2(reopened->nativeHandle(), fd) < 0)
+        {
+            return false;
+        }
+        // The fan-out thread stopped reading the port at the hangup; the new device is worth reading again.
+        if (state->read.fanout != nullptr)
+        {
+            state->read.fanout->error_number = 0;
+        }
+    }
+    if (state->fanout.load())
+    {
+        FanoutReader::instance().wake();
+    }
+    entry.connected = true;
+    return true;
+}
+
+auto ReconnectSupervisor::run(const std::stop_token &stop) -> void
+{
+    const TunedThreadScope tuned;
+    std::vector<struct pollfd> poll_fds;
+    while (!stop.stop_requested())
+    {
+        {
+            const std::scoped_lock lock(mutex_);
+            if (stop.stop_requested())
+            {
+                return;
+            }
+
+            poll_fds.clear();
+            poll_fds.push_back({wake_fd_.get(), POLLIN, 0});
+            poll_fds.push_back({inotify_fd_.get(), POLLIN, 0});
+            for (const auto &[fd, entry] : entries_)
+            {
+                if (entry.connected)
+                {
+                    // No events requested: poll() still reports POLLHUP and POLLERR, which is all we watch for.
+                    poll_fds.push_back({fd, 0, 0});
+                }
+            }
+        }
+
+        if (poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), -1) < 0 && errno != EINTR)
+        {
+            // Nothing sensible to do but stop; ports keep working, they just are not reopened any more.
+            return;
+        }
+
+        const std::scoped_lock lock(mutex_);
+        if (stop.stop_requested())
+        {
+            return;
+        }
+        drain(wake_fd_.get());
+        const bool device_appeared = (poll_fds[1].revents & POLLIN) != 0;
+        drain(inotify_fd_.get());
+
+        bool hangup = false;
+        for (std::size_t i = 2; i < poll_fds.size(); ++i)
+        {
+            const auto entry = entries_.find(poll_fds[i].fd);
+            if (entry != entries_.end() && (poll_fds[i].revents & (POLLHUP | POLLERR)) != 0)
+            {
+                entry->second.connected = false;
+                hangup = true;
+            }
+        }
+        if (!hangup && !device_appeared)
+        {
+            continue;
+        }
+
+        // The device may already be back before the watches are in place, so always try once after refreshing.
+        refreshWatches();
+        bool reconnected = false;
+        for (auto &[fd, entry] : entries_)
+        {
+            if (!entry.connected)
+            {
+                reconnected = tryReconnect(fd, entry) || reconnected;
+            }
+        }
+        if (reconnected)
+        {
+            refreshWatches();
+        }
+    }
+}
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cpp_bindings_linux/detail/unique_fd.hpp>
+#include <cpp_bindings_linux/serial_error.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace cpp_bindings_linux::detail
+{
+// Background thread that reopens supervised ports after their device disconnects.
+//
+// The thread sleeps in a single poll() on an eventfd (supervision changes), an inotify descriptor watching the
+// directories where lost devices will reappear, and every connected supervised port (hangup only). A hangup marks
+// the port disconnected; each inotify event retries the disconnected ports. Nothing is polled on a timer.
+//
+// The reopened device is dup2()ed onto the original descriptor with both side locks held, so the caller's handle
+// and per-port state survive the reconnect. The thread is stopped and joined once no port is supervised any more.
+class ReconnectSupervisor
+{
+  public:
+    static auto instance() -> ReconnectSupervisor &;
+
+    // Starts supervising fd, which must be registered. With an empty usb_serial the device is expected back at
+    // the path it was opened with; otherwise it is looked up by serial number in /dev/serial/by-id.
+    auto add(int fd, std::string usb_serial) -> SerialResult<void>;
+
+    // Stops supervising fd. Once this returns the thread no longer touches the descriptor.
+    auto remove(int fd) -> void;
+
+  private:
+    struct Entry
+    {
+        std::string usb_serial;
+        bool connected = true;
+    };
+
+    ReconnectSupervisor() = default;
+
+    auto run(const std::stop_token &stop) -> void;
+    auto wake() const -> void;
+
+    // Both run with mutex_ held.
+    auto refreshWatches() -> void;
+    auto tryReconnect(int fd, Entry &entry) -> bool;
+
+    std::mutex mutex_;
+    std::map<int, Entry> entries_;
+    UniqueFd wake_fd_;
+    UniqueFd inotify_fd_;
+    std::vector<int> watches_;
+    std::jthread thread_;
+};
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,88 @@
+#include "thread_tuning.hpp"
+
+#include <cpp_core/status_codes.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace cpp_bindings_linux::detail
+{
+auto ThreadTuning::instance() -> ThreadTuning &
+{
+    // Intentionally leaked, like the other singletons: background threads may detach during static destruction.
+    static auto *tuning = new ThreadTuning();
+    return *tuning;
+}
+
+auto ThreadTuning::configure(std::vector<int> cpus, int policy, int priority) -> SerialResult<void>
+{
+    const std::scoped_lock lock(mutex_);
+    cpus_ = std::move(cpus);
+    policy_ = policy;
+    priority_ = priority;
+    configured_ = true;
+
+    int first_error = 0;
+    for (const pthread_t thread : threads_)
+    {
+        const int error = applyTo(thread);
+        if (first_error == 0)
+        {
+            first_error = error;
+        }
+    }
+    if (first_error != 0)
+    {
+        return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, first_error, nullptr});
+    }
+    return {};
+}
+
+auto ThreadTuning::attach(pthread_t thread) -> void
+{
+    const std::scoped_lock lock(mutex_);
+    threads_.push_back(thread);
+    // A failure here (e.g. real-time priority without CAP_SYS_NICE) leaves the thread at the default settings;
+    // configure() is where it gets reported.
+    (void)applyTo(thread);
+}
+
+auto ThreadTuning::detach(pthread_t thread) -> void
+{
+    const std::scoped_lock lock(mutex_);
+    const auto found = std::find_if(threads_.begin(), threads_.end(),
+                                    [thread](pthread_t entry) { return pthread_equal(entry, thread) != 0; });
+    if (found != threads_.end())
+    {
+        threads_.erase(found);
+    }
+}
+
+auto ThreadTuning::applyTo(pthread_t thread) const -> int
+{
+    if (!configured_)
+    {
+        return 0;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cpus_.empty())
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    for (const int cpu : cpus_)
+    {
+        CPU_SET(cpu, &set);
+    }
+    const int affinity_error = pthread_setaffinity_np(thread, sizeof(set), &set);
+
+    struct sched_param param = {};
+    param.sched_priority = priority_;
+    const int sched_error = pthread_setschedparam(thread, policy_, &param);
+    return affinity_error != 0 ? affinity_error : sched_error;
+}
+} // namespace cpp_bindings_linux::detail
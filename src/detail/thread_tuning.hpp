@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cpp_bindings_linux/serial_error.hpp>
+
+#include <mutex>
+#include <pthread.h>
+#include <sched.h>
+#include <vector>
+
+namespace cpp_bindings_linux::detail
+{
+// CPU affinity and scheduling policy for the library's background threads (reconnect supervisor, write pacer,
+// fan-out reader, bridge reactor).
+//
+// Background threads register themselves for their lifetime with a TunedThreadScope. configure() applies new
+// settings to every registered thread at once, and each thread started later applies them on start-up, so the
+// settings hold no matter when a thread is (re)started.
+class ThreadTuning
+{
+  public:
+    static auto instance() -> ThreadTuning &;
+
+    // cpus empty means "no affinity". Applies to the running threads; the first failure is returned (the
+    // settings are kept either way, for threads that start later).
+    auto configure(std::vector<int> cpus, int policy, int priority) -> SerialResult<void>;
+
+    auto attach(pthread_t thread) -> void;
+    auto detach(pthread_t thread) -> void;
+
+  private:
+    ThreadTuning() = default;
+
+    // Called with mutex_ held.
+    auto applyTo(pthread_t thread) const -> int;
+
+    std::mutex mutex_;
+    std::vector<pthread_t> threads_;
+    std::vector<int> cpus_;
+    int policy_ = SCHED_OTHER;
+    int priority_ = 0;
+    bool configured_ = false;
+};
+
+// Registers the calling thread with ThreadTuning for the lifetime of the scope (the body of a background thread).
+class TunedThreadScope
+{
+  public:
+    TunedThreadScope() : thread_(pthread_self())
+    {
+        ThreadTuning::instance().attach(thread_);
+    }
+    ~TunedThreadScope()
+    {
+        ThreadTuning::instance().detach(thread_);
+    }
+
+    TunedThreadScope(const TunedThreadScope &) = delete;
+    auto operator=(const TunedThreadScope &) -> TunedThreadScope & = delete;
+
+  private:
+    pthread_t thread_;
+};
+} // namespace cpp_bindings_linux::detail
@@ -0,0 +1,293 @@
+#include "write_pacer.hpp"
+
+#include <cpp_core/status_codes.h>
+
+#include "port_registry.hpp"
+#include "posix_helpers.hpp"
+#include "thread_tuning.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace cpp_bindings_linux::detail
+{
+namespace
+{
+auto completeHeadFrame(PacedLane &lane, int64_t now_ns) -> void
+{
+    const PacedFrame &frame = lane.frames[lane.frame_head];
+    const int64_t delay_ns = std::max<int64_t>(now_ns - frame.queued_ns, 0);
+    lane.stats.frames_sent += 1;
+    lane.stats.total_delay_ns += delay_ns;
+    lane.stats.max_delay_ns = std::max(lane.stats.max_delay_ns, delay_ns);
+    lane.stats.last_delay_ns = delay_ns;
+    lane.frame_head = (lane.frame_head + 1) % lane.frames.size();
+    lane.frame_count -= 1;
+}
+
+// Hands up to max_bytes from the head of a lane to the kernel. Returns the number of bytes written, or -1 after a
+// write error, which drops everything queued.
+auto sendFromLane(int fd, PacedQueue &queue, PacedLane &lane, std::size_t max_bytes, int64_t now_ns,
+                  int64_t ns_per_byte) -> int64_t
+{
+    const std::size_t count = std::min(max_bytes, lane.size);
+    if (count == 0)
+    {
+        return 0;
+    }
+    const std::size_t first = std::min(count, lane.ring.size() - lane.head);
+    const std::array<struct iovec, 2> parts = {{
+        {lane.ring.data() + lane.head, first},
+        {lane.ring.data(), count - first},
+    }};
+    const ssize_t written = ::writev(fd, parts.data(), count > first ? 2 : 1);
+    if (written > 0)
+    {
+        lane.consume(static_cast<std::size_t>(written), now_ns);
+        queue.wire_free_ns = std::max(queue.wire_free_ns, now_ns) + (written * ns_per_byte);
+        queue.space.notify_all();
+        return written;
+    }
+    if (written < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+        // The port is gone or broken: drop the backlog and let the next queued write report why.
+        queue.error_number = errno;
+        queue.bulk.clear();
+        queue.urgent.clear();
+        queue.space.notify_all();
+        return -1;
+    }
+    return 0;
+}
+} // namespace
+
+auto PacedLane::push(const unsigned char *data, std::size_t count, bool extend, int64_t now_ns) -> std::size_t
+{
+    const bool append = extend && frame_open && frame_count > 0;
+    if (!append && (frame_open || freeFrames() == 0))
+    {
+        return 0;
+    }
+    count = std::min(count, freeSpace());
+    if (count == 0)
+    {
+        return 0;
+    }
+    if (!append)
+    {
+        frames[(frame_head + frame_count) % frames.size()] = PacedFrame{0, 0, now_ns};
+        frame_count += 1;
+        frame_open = true;
+    }
+    frames[(frame_head + frame_count - 1) % frames.size()].size += count;
+
+    const std::size_t tail = (head + size) % ring.size();
+    const std::size_t first = std::min(count, ring.size() - tail);
+    std::memcpy(ring.data() + tail, data, first);
+    std::memcpy(ring.data(), data + first, count - first);
+    size += count;
+    return count;
+}
+
+auto PacedLane::closeFrame(int64_t now_ns) -> void
+{
+    if (!frame_open)
+    {
+        return;
+    }
+    frame_open = false;
+    // Sent completely while open: only the newest frame can be open, so it is also the head.
+    if (frame_count > 0 && size == 0)
+    {
+        completeHeadFrame(*this, now_ns);
+    }
+}
+
+auto PacedLane::consume(std::size_t count, int64_t now_ns) -> void
+{
+    head = (head + count) % ring.size();
+    size -= count;
+    stats.bytes_sent += count;
+    while (frame_count > 0)
+    {
+        PacedFrame &frame = frames[frame_head];
+        const std::size_t taken = std::min(count, frame.size - frame.sent);
+        frame.sent += taken;
+        count -= taken;
+        if (frame.sent < frame.size || (frame_open && frame_count == 1))
+        {
+            break;
+        }
+        completeHeadFrame(*this, now_ns);
+    }
+}
+
+auto PacedLane::clear() -> void
+{
+    head = 0;
+    size = 0;
+    frame_head = 0;
+    frame_count = 0;
+    frame_open = false;
+}
+
+auto topUpPacedQueue(int fd, const PortState &state, PacedQueue &queue) -> int64_t
+{
+    const int64_t ns_per_byte = std::max<int64_t>(state.config.nsPerByte(), 1);
+    const int64_t limit = std::max<int64_t>((static_cast<int64_t>(queue.max_queued_ms) * 1'000'000) / ns_per_byte, 1);
+    const int64_t now_ns = monotonicNowNs();
+
+    int kernel_queued = 0;
+    if (ioctl(fd, TIOCOUTQ, &kernel_queued) != 0)
+    {
+        kernel_queued = 0;
+    }
+    const int64_t modelled = std::max<int64_t>(queue.wire_free_ns - now_ns, 0) / ns_per_byte;
+    int64_t queued = std::max<int64_t>(kernel_queued, modelled);
+
+    const auto send = [&](PacedLane &lane, std::size_t max_bytes) {
+        const int64_t written = sendFromLane(fd, queue, lane, max_bytes, now_ns, ns_per_byte);
+        queued += std::max<int64_t>(written, 0);
+        return written >= 0;
+    };
+    const auto budget = [&]() { return static_cast<std::size_t>(std::max<int64_t>(limit - queued, 0)); };
+
+    bool ok = true;
+    if (queue.urgent.size > 0 && !queue.bulk.atFrameBoundary())
+    {
+        // Finish the bulk frame that is on the wire; urgent frames follow right after its last byte.
+        ok = send(queue.bulk, std::min(budget(), queue.bulk.headFrameRemaining()));
+    }
+    if (ok && queue.urgent.size > 0 && queue.bulk.atFrameBoundary())
+    {
+        // Not held to the bound: urgent frames are short, and any wait here is the delay the lane exists to avoid.
+        ok = send(queue.urgent, queue.urgent.size);
+    }
+    if (ok && queue.urgent.size == 0)
+    {
+        ok = send(queue.bulk, budget());
+    }
+
+    if (!ok || (queue.bulk.size == 0 && queue.urgent.size == 0))
+    {
+        return std::numeric_limits<int64_t>::max();
+    }
+    // Come back when the kernel is down to half the bound; at least one character time, so a stalled
+    // (flow-controlled) port is re-checked at wire speed rather than in a spin.
+    return now_ns + std::max<int64_t>(queued - (limit / 2), 1) * ns_per_byte;
+}
+
+auto WritePacer::instance() -> WritePacer &
+{
+    // Intentionally leaked, like the port registry: the thread may outlive static destruction.
+    static auto *pacer = new WritePacer();
+    return *pacer;
+}
+
+auto WritePacer::add(int fd) -> SerialResult<void>
+{
+    const std::scoped_lock lock(mutex_);
+    if (!wake_fd_.valid())
+    {
+        wake_fd_.reset(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+        if (!wake_fd_.valid())
+        {
+            return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, errno, nullptr});
+        }
+    }
+
+    fds_.insert(fd);
+    if (thread_.joinable())
+    {
+        wake();
+        return {};
+    }
+    try
+    {
+        thread_ = std::jthread([this](const std::stop_token &stop) { run(stop); });
+    }
+    catch (const std::system_error &error)
+    {
+        fds_.erase(fd);
+        return std::unexpected(SerialError{cpp_core::StatusCodes::kSetStateError, error.code().value(), nullptr});
+    }
+    return {};
+}
+
+auto WritePacer::remove(int fd) -> void
+{
+    std::jthread stopped;
+    {
+        const std::scoped_lock lock(mutex_);
+        if (fds_.erase(fd) == 0)
+        {
+            return;
+        }
+        if (fds_.empty())
+        {
+            thread_.request_stop();
+            stopped = std::move(thread_);
+        }
+        wake();
+    }
+    // Joined outside the lock, because the thread takes it once more on its way out.
+}
+
+auto WritePacer::wake() const -> void
+{
+    const uint64_t one = 1;
+    (void)write(wake_fd_.get(), &one, sizeof(one));
+}
+
+auto WritePacer::run(const std::stop_token &stop) -> void
+{
+    const TunedThreadScope tuned;
+    while (true)
+    {
+        int64_t next_ns = std::numeric_limits<int64_t>::max();
+        {
+            const std::scoped_lock lock(mutex_);
+            if (stop.stop_requested())
+            {
+                return;
+            }
+            uint64_t drained = 0;
+            (void)read(wake_fd_.get(), &drained, sizeof(drained));
+
+            for (const int fd : fds_)
+            {
+                PortState *state = PortRegistry::instance().find(fd);
+                if (state == nullptr)
+                {
+                    continue;
+                }
+                const std::scoped_lock side_lock(state->write.mutex);
+                if (state->write.pacing != nullptr)
+                {
+                    next_ns = std::min(next_ns, topUpPacedQueue(fd, *state, *state->write.pacing));
+                }
+            }
+        }
+
+        struct pollfd poll_fd = {wake_fd_.get(), POLLIN, 0};
+        if (next_ns == std::numeric_limits<int64_t>::max())
+        {
+            poll(&poll_fd, 1, -1);
+            continue;
+        }
+        const int64_t wait_ns = std::max<int64_t>(next_ns - monotonicNowNs(), 0);
+        const struct timespec timeout = {static_cast<time_t>(wait_ns / 1'000'000'000),
+                                         static_cast<long>(wait_ns % 1'000'000'000)};
+        ppoll(&poll_fd, 1, &timeout, nullptr);
+    }
+}
+} // namespace cpp_bindings_linux::detail
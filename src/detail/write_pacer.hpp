@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cpp_bindings_linux/detail/unique_fd.hpp>
+#include <cpp_bindings_linux/serial_error.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace cpp_bindings_linux::detail
+{
+struct PortState;
+
+// Frame slots per lane; a writer that finds them all taken waits like it does for buffer space.
+constexpr std::size_t kBulkLaneFrames = 1024;
+constexpr std::size_t kUrgentLaneFrames = 64;
+
+// The bytes of one serialWritePaced() / serialWritePriority() call.
+struct PacedFrame
+{
+    std::size_t size = 0; // bytes queued so far
+    std::size_t sent = 0; // of those, bytes handed to the kernel
+    int64_t queued_ns = 0;
+};
+
+struct PacedLaneStats
+{
+    uint64_t frames_sent = 0;
+    uint64_t bytes_sent = 0;
+    int64_t total_delay_ns = 0;
+    int64_t max_delay_ns = 0;
+    int64_t last_delay_ns = 0;
+};
+
+// One priority class of a paced queue: a ring of bytes plus the frame boundaries in it. Both are sized up front,
+// so queueing never allocates.
+//
+// A frame stays open while its writer waits for room to queue the rest; the pacer may send what is there, but the
+// frame only ends (and the next one may start on the wire) once the writer closes it.
+struct PacedLane
+{
+    PacedLane(std::size_t capacity, std::size_t max_frames) : ring(capacity), frames(max_frames)
+    {
+    }
+
+    [[nodiscard]] auto freeSpace() const -> std::size_t
+    {
+        return ring.size() - size;
+    }
+
+    [[nodiscard]] auto freeFrames() const -> std::size_t
+    {
+        return frames.size() - frame_count;
+    }
+
+    // True unless the frame at the head has been handed to the kernel in part.
+    [[nodiscard]] auto atFrameBoundary() const -> bool
+    {
+        return frame_count == 0 || frames[frame_head].sent == 0;
+    }
+
+    // Queued bytes up to the end of the head frame.
+    [[nodiscard]] auto headFrameRemaining() const -> std::size_t
+    {
+        return frame_count == 0 ? 0 : frames[frame_head].size - frames[frame_head].sent;
+    }
+
+    // Copies as much of data as fits, appending to the open frame when extend is set and starting a new (open)
+    // frame otherwise. Returns the number of bytes queued: 0 when another writer's frame is still open or no
+    // frame slot is free.
+    auto push(const unsigned char *data, std::size_t count, bool extend, int64_t now_ns) -> std::size_t;
+
+    // The writer of the open frame is done with it.
+    auto closeFrame(int64_t now_ns) -> void;
+
+    // count bytes from the head went to the kernel; completes the frames they finish.
+    auto consume(std::size_t count, int64_t now_ns) -> void;
+
+    // Drops everything queued; the counters stay.
+    auto clear() -> void;
+
+    std::vector<unsigned char> ring;
+    std::size_t head = 0; // oldest queued byte
+    std::size_t size = 0;
+
+    std::vector<PacedFrame> frames;
+    std::size_t frame_head = 0;
+    std::size_t frame_count = 0;
+    bool frame_open = false; // the newest frame may still grow
+
+    PacedLaneStats stats;
+};
+
+// Userspace send queue of a handle in paced-write mode (serialSetWritePacing()). Guarded by the write-side mutex.
+//
+// Bytes wait in fixed ring buffers and are handed to the kernel only while its output queue holds less than
+// max_queued_ms of wire time, so anything written directly (serialWrite()) waits behind at most that much data.
+// Frames in the urgent lane go out at the next bulk frame boundary, ahead of queued bulk data, and are not held
+// back by the bound.
+struct PacedQueue
+{
+    PacedQueue(int in_max_queued_ms, std::size_t capacity, std::size_t urgent_capacity)
+        : max_queued_ms(in_max_queued_ms), bulk(capacity, kBulkLaneFrames), urgent(urgent_capacity, kUrgentLaneFrames)
+    {
+    }
+
+    int max_queued_ms;
+    PacedLane bulk;
+    PacedLane urgent;
+
+    // When the bytes already handed to the kernel will have left the UART, by our own wire-time model. TIOCOUTQ
+    // alone is not enough: USB adapters and ptys report bytes as sent once they left the kernel.
+    int64_t wire_free_ns = 0;
+
+    int error_number = 0;          // errno of a failed background write, reported by the next queued write
+    std::condition_variable space; // signalled when the pacer has drained bytes (or failed), or a frame closed
+};
+
+// Background thread that feeds the paced queues of all handles to their ports.
+//
+// Each pass tops every queue up to its bound and then sleeps (ppoll on an eventfd) until the first port's kernel
+// queue is expected to be down to half its bound, so a bulk transfer costs one wakeup per half bound instead of
+// a thread per port or a spin. The thread exits once no handle is paced any more.
+class WritePacer
+{
+  public:
+    static auto instance() -> WritePacer &;
+
+    auto add(int fd) -> SerialResult<void>;
+
+    // Once this returns the thread no longer touches the descriptor.
+    auto remove(int fd) -> void;
+
+    // New data was queued: re-plan the next wakeup.
+    auto wake() const -> void;
+
+  private:
+    WritePacer() = default;
+
+    auto run(const std::stop_token &stop) -> void;
+
+    std::mutex mutex_;
+    std::set<int> fds_;
+    UniqueFd wake_fd_;
+    std::jthread thread_;
+};
+
+// Hands queued bytes to the kernel, up to the queue's bound. Called with the write-side mutex held. Returns the
+// CLOCK_MONOTONIC time at which the queue wants the next top-up, or INT64_MAX when it is empty.
+auto topUpPacedQueue(int fd, const PortState &state, PacedQueue &queue) -> int64_t;
+} // namespace cpp_bindings_linux::detail
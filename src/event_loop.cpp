@@ -0,0 +1,373 @@
+#include <cpp_bindings_linux/event_loop.hpp>
+#include <cpp_core/status_codes.h>
+
+#include "detail/posix_helpers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <sys/epoll.h>
+#include <unordered_map>
+#include <vector>
+
+namespace cpp_bindings_linux
+{
+namespace
+{
+struct FdEntry
+{
+    std::deque<detail::FdWaiter *> readers;
+    std::deque<detail::FdWaiter *> writers;
+    uint32_t events = 0; // interest currently registered with epoll
+};
+
+constexpr uint32_t kHangupEvents = EPOLLHUP | EPOLLERR;
+
+auto deadlineFor(std::chrono::milliseconds timeout) -> int64_t
+{
+    return detail::monotonicNowNs() + (static_cast<int64_t>(detail::toTimeoutMs(timeout)) * 1'000'000);
+}
+} // namespace
+
+struct EventLoop::State
+{
+    std::unordered_map<int, FdEntry> fds;
+    std::multimap<int64_t, detail::FdWaiter *> timers;
+    std::vector<std::coroutine_handle<>> ready;
+    std::vector<std::coroutine_handle<>> resuming;
+    std::vector<Task<void>> spawned;
+    std::array<struct epoll_event, 64> events{};
+};
+
+ReadinessAwaitable::ReadinessAwaitable(EventLoop &loop, int fd, bool for_read,
+                                       std::chrono::milliseconds timeout) noexcept
+    : loop_(&loop)
+{
+    waiter_.fd = fd;
+    waiter_.for_read = for_read;
+    waiter_.deadline_ns = deadlineFor(timeout);
+}
+
+auto ReadinessAwaitable::await_suspend(std::coroutine_handle<> handle) -> bool
+{
+    waiter_.handle = handle;
+    return loop_->suspend(waiter_);
+}
+
+auto ReadinessAwaitable::await_resume() const -> SerialResult<bool>
+{
+    if (waiter_.error_number != 0)
+    {
+        return std::unexpected(SerialError{cpp_core::StatusCodes::kInvalidHandleError, waiter_.error_number, nullptr});
+    }
+    return !waiter_.timed_out;
+}
+
+auto EventLoop::create() -> SerialResult<std::unique_ptr<EventLoop>>
+{
+    detail::UniqueFd epoll_fd(epoll_create1(EPOLL_CLOEXEC));
+    if (!epoll_fd.valid())
+    {
+        return std::unexpected(SerialError{cpp_core::StatusCodes::kGetStateError, errno, nullptr});
+    }
+    return std::unique_ptr<EventLoop>(new EventLoop(std::move(epoll_fd)));
+}
+
+EventLoop::EventLoop(detail::UniqueFd epoll_fd) : epoll_fd_(std::move(epoll_fd)), state_(std::make_unique<State>())
+{
+}
+
+EventLoop::~EventLoop() = default;
+
+auto EventLoop::pendingWaits() const noexcept -> std::size_t
+{
+    return state_->timers.size();
+}
+
+namespace
+{
+// Brings the epoll registration of fd in line with its queues; drops the entry once nobody waits on it.
+auto updateInterest(int epoll_fd, std::unordered_map<int, FdEntry> &fds,
+                    std::unordered_map<int, FdEntry>::iterator entry) -> int
+{
+    const int fd = entry->first;
+    const uint32_t wanted =
+        (entry->second.readers.empty() ? 0U : static_cast<uint32_t>(EPOLLIN)) |
+        (entry->second.writers.empty() ? 0U : static_cast<uint32_t>(EPOLLOUT));
+    if (wanted == entry->second.events)
+    {
+        if (wanted == 0)
+        {
+            fds.erase(entry);
+        }
+        return 0;
+    }
+
+    if (wanted == 0)
+    {
+        // The descriptor may already be closed; epoll forgets closed descriptors on its own.
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        fds.erase(entry);
+        return 0;
+    }
+
+    struct epoll_event event = {};
+    event.events = wanted;
+    event.data.fd = fd;
+    const int op = entry->second.events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    if (epoll_ctl(epoll_fd, op, fd, &event) != 0)
+    {
+        return errno;
+    }
+    entry->second.events = wanted;
+    return 0;
+}
+} // namespace
+
+auto EventLoop::suspend(detail::FdWaiter &waiter) -> bool
+{
+    auto entry = state_->fds.try_emplace(waiter.fd).first;
+    auto &queue = waiter.for_read ? entry->second.readers : entry->second.writers;
+    queue.push_back(&waiter);
+
+    const int error_number = updateInterest(epoll_fd_.get(), state_->fds, entry);
+    if (error_number != 0)
+    {
+        queue.pop_back();
+        updateInterest(epoll_fd_.get(), state_->fds, entry);
+        waiter.error_number = error_number;
+        return false;
+    }
+
+    waiter.timer = state_->timers.emplace(waiter.deadline_ns, &waiter);
+    return true;
+}
+
+auto EventLoop::spawn(Task<void> task) -> void
+{
+    std::erase_if(state_->spawned, [](const Task<void> &finished) { return finished.done(); });
+    task.start();
+    if (!task.done())
+    {
+        state_->spawned.push_back(std::move(task));
+    }
+}
+
+auto EventLoop::runOnce(std::chrono::milliseconds timeout) -> SerialResult<std::size_t>
+{
+    State &state = *state_;
+
+    int wait_ms = detail::toTimeoutMs(timeout);
+    if (!state.timers.empty())
+    {
+        const int64_t until_deadline_ns = state.timers.begin()->first - detail::monotonicNowNs();
+        const int64_t until_deadline_ms = until_deadline_ns <= 0 ? 0 : (until_deadline_ns + 999'999) / 1'000'000;
+        wait_ms = static_cast<int>(std::min<int64_t>(wait_ms, until_deadline_ms));
+    }
+
+    int event_count = epoll_wait(epoll_fd_.get(), state.events.data(), static_cast<int>(state.events.size()), wait_ms);
+    if (event_count < 0)
+    {
+        if (errno != EINTR)
+        {
+            return std::unexpected(SerialError{cpp_core::StatusCodes::kReadError, errno, nullptr});
+        }
+        event_count = 0;
+    }
+
+    const auto complete = [&state](std::deque<detail::FdWaiter *> &queue) {
+        detail::FdWaiter *waiter = queue.front();
+        queue.pop_front();
+        state.timers.erase(waiter->timer);
+        state.ready.push_back(waiter->handle);
+    };
+
+    // Level-triggered: wake the oldest waiter per direction; if more data is left, the next epoll_wait reports
+    // the descriptor again for whoever is next in line.
+    for (int i = 0; i < event_count; ++i)
+    {
+        const auto &event = state.events[static_cast<std::size_t>(i)];
+        auto entry = state.fds.find(event.data.fd);
+        if (entry == state.fds.end())
+        {
+            continue;
+        }
+        if ((event.events & (EPOLLIN | kHangupEvents)) != 0 && !entry->second.readers.empty())
+        {
+            complete(entry->second.readers);
+        }
+        if ((event.events & (EPOLLOUT | kHangupEvents)) != 0 && !entry->second.writers.empty())
+        {
+            complete(entry->second.writers);
+        }
+        updateInterest(epoll_fd_.get(), state.fds, entry);
+    }
+
+    const int64_t now_ns = detail::monotonicNowNs();
+    while (!state.timers.empty() && state.timers.begin()->first <= now_ns)
+    {
+        detail::FdWaiter *waiter = state.timers.begin()->second;
+        state.timers.erase(state.timers.begin());
+        waiter->timed_out = true;
+
+        auto entry = state.fds.find(waiter->fd);
+        auto &queue = waiter->for_read ? entry->second.readers : entry->second.writers;
+        queue.erase(std::find(queue.begin(), queue.end(), waiter));
+        updateInterest(epoll_fd_.get(), state.fds, entry);
+
+        state.ready.push_back(waiter->handle);
+    }
+
+    // Resumed coroutines may register new waits, so resume from a separate list.
+    state.resuming.swap(state.ready);
+    for (const auto handle : state.resuming)
+    {
+        handle.resume();
+    }
+    const std::size_t resumed = state.resuming.size();
+    state.resuming.clear();
+
+    std::erase_if(state.spawned, [](const Task<void> &finished) { return finished.done(); });
+
+    return resumed;
+}
+
+auto EventLoop::run() -> SerialResult<void>
+{
+    while (pendingWaits() > 0)
+    {
+        const auto result = runOnce(std::chrono::milliseconds::max());
+        if (!result)
+        {
+            return std::unexpected(result.error());
+        }
+    }
+    return {};
+}
+
+auto asyncRead(EventLoop &loop, SerialPortView port, std::span<std::byte> buffer, std::chrono::milliseconds timeout)
+    -> Task<SerialResult<std::size_t>>
+{
+    if (buffer.empty())
+    {
+        co_return std::unexpected(
+            SerialError{cpp_core::StatusCodes::kBufferError, 0, "Invalid buffer or buffer_size"});
+    }
+
+    const int size = static_cast<int>(std::min<std::size_t>(buffer.size(), std::numeric_limits<int>::max()));
+
+    // Data that is already queued is returned without suspending.
+    ssize_t bytes = detail::readNonBlocking(port.nativeHandle(), buffer.data(), size);
+    if (bytes != 0 || detail::toTimeoutMs(timeout) == 0)
+    {
+        if (bytes < 0)
+        {
+            co_return std::unexpected(SerialError{cpp_core::StatusCodes::kReadError, errno, nullptr});
+        }
+        co_return static_cast<std::size_t>(bytes);
+    }
+
+    const auto ready = co_await loop.readable(port.nativeHandle(), timeout);
+    if (!ready)
+    {
+        co_return std::unexpected(ready.error());
+    }
+    if (!*ready)
+    {
+        co_return 0;
+    }
+
+    bytes = detail::readAfterReady(port.nativeHandle(), buffer.data(), size);
+    if (bytes < 0)
+    {
+        co_return std::unexpected(SerialError{cpp_core::StatusCodes::kReadError, errno, nullptr});
+    }
+    co_return static_cast<std::size_t>(bytes);
+}
+
+auto asyncWrite(EventLoop &loop, SerialPortView port, std::span<const std::byte> data,
+                std::chrono::milliseconds timeout) -> Task<SerialResult<std::size_t>>
+{
+    if (data.empty())
+    {
+        co_return std::unexpected(
+            SerialError{cpp_core::StatusCodes::kBufferError, 0, "Invalid buffer or buffer_size"});
+    }
+
+    const detail::Deadline deadline(detail::toTimeoutMs(timeout));
+    std::size_t written = 0;
+    while (written < data.size())
+    {
+        const ssize_t bytes = ::write(port.nativeHandle(), data.data() + written, data.size() - written);
+        if (bytes > 0)
+        {
+            written += static_cast<std::size_t>(bytes);
+            continue;
+        }
+        if (bytes < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            co_return std::unexpected(SerialError{cpp_core::StatusCodes::kWriteError, errno, nullptr});
+        }
+
+        const int remaining_ms = deadline.remainingMs();
+        if (remaining_ms == 0)
+        {
+            break;
+        }
+        const auto ready = co_await loop.writable(port.nativeHandle(), std::chrono::milliseconds(remaining_ms));
+        if (!ready)
+        {
+            co_return std::unexpected(ready.error());
+        }
+        if (!*ready)
+        {
+            break;
+        }
+    }
+    co_return written;
+}
+
+auto asyncReadUntil(EventLoop &loop, SerialPortView port, std::span<std::byte> buffer, std::byte delimiter,
+                    std::chrono::milliseconds timeout) -> Task<SerialResult<ReadUntilResult>>
+{
+    if (buffer.empty())
+    {
+        co_return std::unexpected(
+            SerialError{cpp_core::StatusCodes::kBufferError, 0, "Invalid buffer or buffer_size"});
+    }
+
+    const detail::Deadline deadline(detail::toTimeoutMs(timeout));
+    ReadUntilResult result;
+    while (result.bytes_read < buffer.size())
+    {
+        const auto chunk = co_await asyncRead(loop, port, buffer.subspan(result.bytes_read),
+                                              std::chrono::milliseconds(deadline.remainingMs()));
+        if (!chunk)
+        {
+            co_return std::unexpected(chunk.error());
+        }
+        if (*chunk == 0)
+        {
+            break;
+        }
+
+        const std::byte *begin = buffer.data() + result.bytes_read;
+        const auto *found = static_cast<const std::byte *>(std::memchr(begin, static_cast<int>(delimiter), *chunk));
+        result.bytes_read += *chunk;
+        if (found != nullptr)
+        {
+            result.frame_size = static_cast<std::size_t>(found - buffer.data()) + 1;
+            break;
+        }
+    }
+    co_return result;
+}
+
+} // namespace cpp_bindings_linux
@@ -0,0 +1,224 @@
+#include <cpp_bindings_linux/event_loop.hpp>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/pty_pair.hpp"
+
+using cpp_bindings_linux::EventLoop;
+using cpp_bindings_linux::SerialPortView;
+using cpp_bindings_linux::Task;
+using namespace std::chrono_literals;
+
+namespace
+{
+auto asBytes(const char *text) -> std::span<const std::byte>
+{
+    return {reinterpret_cast<const std::byte *>(text), std::strlen(text)};
+}
+} // namespace
+
+class EventLoopTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        auto created = EventLoop::create();
+        ASSERT_TRUE(created) << created.error().what();
+        loop = std::move(*created);
+
+        ASSERT_EQ(pipe2(pipefd.data(), O_NONBLOCK), 0);
+    }
+
+    void TearDown() override
+    {
+        close(pipefd[0]);
+        close(pipefd[1]);
+    }
+
+    std::unique_ptr<EventLoop> loop;
+    std::array<int, 2> pipefd{};
+};
+
+TEST_F(EventLoopTest, ReadResumesWhenDataArrives)
+{
+    std::array<std::byte, 16> buffer{};
+    std::size_t received = 0;
+    loop->spawn([](EventLoop &event_loop, int fd, std::span<std::byte> out, std::size_t &count) -> Task<void> {
+        const auto result = co_await cpp_bindings_linux::asyncRead(event_loop, SerialPortView(fd), out, 1000ms);
+        count = result.value_or(0);
+    }(*loop, pipefd[0], buffer, received));
+
+    EXPECT_EQ(loop->pendingWaits(), 1U);
+    ASSERT_EQ(write(pipefd[1], "hello", 5), 5);
+
+    ASSERT_TRUE(loop->run());
+    EXPECT_EQ(received, 5U);
+    EXPECT_EQ(std::memcmp(buffer.data(), "hello", 5), 0);
+    EXPECT_EQ(loop->pendingWaits(), 0U);
+}
+
+TEST_F(EventLoopTest, ReadTimesOut)
+{
+    std::array<std::byte, 16> buffer{};
+    bool finished = false;
+    std::size_t received = 99;
+    loop->spawn([](EventLoop &event_loop, int fd, std::span<std::byte> out, std::size_t &count,
+                   bool &done) -> Task<void> {
+        const auto result = co_await cpp_bindings_linux::asyncRead(event_loop, SerialPortView(fd), out, 20ms);
+        count = result.value_or(99);
+        done = true;
+    }(*loop, pipefd[0], buffer, received, finished));
+
+    ASSERT_TRUE(loop->run());
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(received, 0U);
+}
+
+TEST_F(EventLoopTest, ReadUntilStopsAtDelimiter)
+{
+    ASSERT_EQ(write(pipefd[1], "abc", 3), 3);
+
+    std::array<std::byte, 32> buffer{};
+    cpp_bindings_linux::ReadUntilResult frame;
+    loop->spawn([](EventLoop &event_loop, int fd, std::span<std::byte> out,
+                   cpp_bindings_linux::ReadUntilResult &result) -> Task<void> {
+        const auto read = co_await cpp_bindings_linux::asyncReadUntil(event_loop, SerialPortView(fd), out,
+                                                                      std::byte{'\n'}, 1000ms);
+        result = read.value_or(cpp_bindings_linux::ReadUntilResult{});
+    }(*loop, pipefd[0], buffer, frame));
+
+    // The first chunk has no delimiter, so the coroutine is parked again until the rest arrives.
+    ASSERT_TRUE(loop->runOnce(0ms));
+    EXPECT_EQ(loop->pendingWaits(), 1U);
+    ASSERT_EQ(write(pipefd[1], "def\nxy", 6), 6);
+
+    ASSERT_TRUE(loop->run());
+    EXPECT_EQ(frame.frame_size, 7U);
+    EXPECT_EQ(frame.bytes_read, 9U);
+    EXPECT_EQ(std::memcmp(buffer.data(), "abcdef\n", 7), 0);
+}
+
+TEST_F(EventLoopTest, WriteSuspendsUntilTheReaderDrains)
+{
+    ASSERT_GT(fcntl(pipefd[1], F_SETPIPE_SZ, 4096), 0);
+    const std::string payload(64 * 1024, 'w');
+
+    std::size_t written = 0;
+    loop->spawn([](EventLoop &event_loop, int fd, std::span<const std::byte> data, std::size_t &count) -> Task<void> {
+        const auto result = co_await cpp_bindings_linux::asyncWrite(event_loop, SerialPortView(fd), data, 5000ms);
+        count = result.value_or(0);
+    }(*loop, pipefd[1], asBytes(payload.c_str()), written));
+
+    std::array<char, 4096> sink{};
+    std::size_t drained = 0;
+    while (loop->pendingWaits() > 0)
+    {
+        const ssize_t bytes = read(pipefd[0], sink.data(), sink.size());
+        drained += bytes > 0 ? static_cast<std::size_t>(bytes) : 0U;
+        ASSERT_TRUE(loop->runOnce(10ms));
+    }
+    while (true)
+    {
+        const ssize_t bytes = read(pipefd[0], sink.data(), sink.size());
+        if (bytes <= 0)
+        {
+            break;
+        }
+        drained += static_cast<std::size_t>(bytes);
+    }
+
+    EXPECT_EQ(written, payload.size());
+    EXPECT_EQ(drained, payload.size());
+}
+
+TEST_F(EventLoopTest, ManyConcurrentReadsShareOneThread)
+{
+    constexpr int kPorts = 200;
+    std::vector<std::array<int, 2>> pipes(kPorts);
+    std::vector<std::array<std::byte, 8>> buffers(kPorts);
+    int completed = 0;
+
+    for (int i = 0; i < kPorts; ++i)
+    {
+        ASSERT_EQ(pipe2(pipes[static_cast<std::size_t>(i)].data(), O_NONBLOCK), 0);
+        loop->spawn([](EventLoop &event_loop, int fd, std::span<std::byte> out, int &done) -> Task<void> {
+            const auto result = co_await cpp_bindings_linux::asyncRead(event_loop, SerialPortView(fd), out, 2000ms);
+            if (result && *result == 1)
+            {
+                ++done;
+            }
+        }(*loop, pipes[static_cast<std::size_t>(i)][0], buffers[static_cast<std::size_t>(i)], completed));
+    }
+    EXPECT_EQ(loop->pendingWaits(), static_cast<std::size_t>(kPorts));
+
+    for (const auto &pipe_pair : pipes)
+    {
+        ASSERT_EQ(write(pipe_pair[1], "x", 1), 1);
+    }
+    ASSERT_TRUE(loop->run());
+    EXPECT_EQ(completed, kPorts);
+
+    for (const auto &pipe_pair : pipes)
+    {
+        close(pipe_pair[0]);
+        close(pipe_pair[1]);
+    }
+}
+
+TEST_F(EventLoopTest, UnwatchableDescriptorIsReported)
+{
+    int fd = open("/dev/null", O_RDONLY);
+    ASSERT_GE(fd, 0);
+
+    bool failed = false;
+    loop->spawn([](EventLoop &event_loop, int watched, bool &error_seen) -> Task<void> {
+        const auto ready = co_await event_loop.readable(watched, 100ms);
+        error_seen = !ready.has_value();
+    }(*loop, fd, failed));
+
+    EXPECT_TRUE(failed);
+    EXPECT_EQ(loop->pendingWaits(), 0U);
+    close(fd);
+}
+
+TEST_F(EventLoopTest, PtyRoundTrip)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    auto port = cpp_bindings_linux::SerialPort::open(pty.slave_path, cpp_bindings_linux::SerialOptions{});
+    ASSERT_TRUE(port);
+
+    std::array<std::byte, 16> buffer{};
+    std::size_t received = 0;
+    loop->spawn([](EventLoop &event_loop, SerialPortView view, std::span<std::byte> out,
+                   std::size_t &count) -> Task<void> {
+        const auto sent = co_await cpp_bindings_linux::asyncWrite(event_loop, view, asBytes("ping"), 1000ms);
+        if (!sent || *sent != 4)
+        {
+            co_return;
+        }
+        const auto result = co_await cpp_bindings_linux::asyncRead(event_loop, view, out, 1000ms);
+        count = result.value_or(0);
+    }(*loop, port->view(), buffer, received));
+
+    std::array<char, 8> request{};
+    ASSERT_EQ(read(pty.master_fd, request.data(), request.size()), 4);
+    ASSERT_EQ(write(pty.master_fd, "pong", 4), 4);
+
+    ASSERT_TRUE(loop->run());
+    EXPECT_EQ(received, 4U);
+    EXPECT_EQ(std::memcmp(buffer.data(), "pong", 4), 0);
+}
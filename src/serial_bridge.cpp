@@ -0,0 +1,127 @@
+#include <cpp_bindings_linux/interface/serial_bridge.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/fd_bridge.hpp"
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <memory>
+
+namespace
+{
+constexpr int kDirections = kSerialBridgeToFd | kSerialBridgeFromFd;
+
+auto perSecond(uint64_t bytes, int64_t elapsed_ns) -> uint64_t
+{
+    if (elapsed_ns <= 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>((static_cast<long double>(bytes) * 1e9L) / static_cast<long double>(elapsed_ns));
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialBridgeStart(int64_t handle, int fd, int flags, ErrorCallbackT error_callback) -> int64_t
+    {
+        if ((flags & kDirections) == 0 || (flags & ~(kDirections | kSerialBridgeCopyOnly)) != 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int64_t>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid flags: need a direction");
+        }
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int64_t>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+        const int port_fd = static_cast<int>(handle);
+        if (fd < 0 || fd == port_fd || fcntl(fd, F_GETFD) < 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int64_t>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid fd");
+        }
+
+        if ((flags & kSerialBridgeToFd) != 0)
+        {
+            const auto side_lock = cpp_bindings_linux::detail::lockReadSide(state);
+            if (cpp_bindings_linux::detail::rejectFanoutRead(state, error_callback) ||
+                cpp_bindings_linux::detail::rejectCompressedRead(state, error_callback))
+            {
+                return static_cast<int64_t>(cpp_core::StatusCodes::kReadError);
+            }
+        }
+        if ((flags & kSerialBridgeFromFd) != 0)
+        {
+            const auto side_lock = cpp_bindings_linux::detail::lockWriteSide(state);
+            if (cpp_bindings_linux::detail::rejectCompressedWrite(state, error_callback))
+            {
+                return static_cast<int64_t>(cpp_core::StatusCodes::kWriteError);
+            }
+        }
+
+        const bool splice = (flags & kSerialBridgeCopyOnly) == 0;
+        auto bridge = std::make_unique<cpp_bindings_linux::detail::Bridge>();
+        bridge->port_fd = port_fd;
+        bridge->started_ns = cpp_bindings_linux::detail::monotonicNowNs();
+        if ((flags & kSerialBridgeToFd) != 0)
+        {
+            bridge->to_fd = cpp_bindings_linux::detail::makePump(port_fd, fd, splice);
+        }
+        if ((flags & kSerialBridgeFromFd) != 0)
+        {
+            bridge->from_fd = cpp_bindings_linux::detail::makePump(fd, port_fd, splice);
+        }
+
+        // Set first, so a serialClose() racing with the start still finds the bridge to stop.
+        state->bridged.store(true);
+        const auto id = cpp_bindings_linux::detail::BridgeReactor::instance().add(std::move(bridge));
+        if (!id)
+        {
+            return cpp_bindings_linux::detail::failError<int64_t>(error_callback, id.error());
+        }
+        return *id;
+    }
+
+    MODULE_API auto serialBridgeStop(int64_t bridge, ErrorCallbackT error_callback) -> int
+    {
+        if (!cpp_bindings_linux::detail::BridgeReactor::instance().remove(bridge))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                            "Unknown bridge");
+        }
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialBridgeStats(int64_t bridge, SerialBridgeStats *stats, ErrorCallbackT error_callback) -> int
+    {
+        if (stats == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "stats is nullptr");
+        }
+        const auto counters = cpp_bindings_linux::detail::BridgeReactor::instance().counters(bridge);
+        if (!counters)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                            "Unknown bridge");
+        }
+
+        const int64_t elapsed_ns =
+            std::max<int64_t>(cpp_bindings_linux::detail::monotonicNowNs() - counters->started_ns, 0);
+        *stats = SerialBridgeStats{};
+        stats->bytes_to_fd = counters->bytes_to_fd;
+        stats->bytes_from_fd = counters->bytes_from_fd;
+        stats->spliced_bytes = counters->spliced_bytes;
+        stats->to_fd_bytes_per_sec = perSecond(counters->bytes_to_fd, elapsed_ns);
+        stats->from_fd_bytes_per_sec = perSecond(counters->bytes_from_fd, elapsed_ns);
+        stats->elapsed_ns = elapsed_ns;
+        stats->active_directions =
+            (counters->to_fd_running ? kSerialBridgeToFd : 0) | (counters->from_fd_running ? kSerialBridgeFromFd : 0);
+        stats->error_number = counters->error_number;
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+} // extern "C"
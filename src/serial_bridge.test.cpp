@@ -0,0 +1,211 @@
+#include <cpp_bindings_linux/interface/serial_bridge.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/status_codes.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+// Reads from a plain descriptor until size bytes arrived or nothing came for timeout_ms.
+auto readFd(int fd, std::size_t size, int timeout_ms = 1000) -> std::string
+{
+    std::string out;
+    std::array<char, 4096> buffer{};
+    while (out.size() < size)
+    {
+        struct pollfd poll_fd = {fd, POLLIN, 0};
+        if (poll(&poll_fd, 1, timeout_ms) <= 0)
+        {
+            break;
+        }
+        const ssize_t bytes = read(fd, buffer.data(), std::min(buffer.size(), size - out.size()));
+        if (bytes <= 0)
+        {
+            break;
+        }
+        out.append(buffer.data(), static_cast<std::size_t>(bytes));
+    }
+    return out;
+}
+
+auto waitForStats(int64_t bridge, const auto &done) -> SerialBridgeStats
+{
+    SerialBridgeStats stats{};
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (serialBridgeStats(bridge, &stats, nullptr) == 0 && !done(stats) &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return stats;
+}
+} // namespace
+
+class SerialBridgeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        handle = pty.openSlave();
+        ASSERT_GT(handle, 0);
+        ASSERT_EQ(pipe2(pipe_fds.data(), O_NONBLOCK | O_CLOEXEC), 0);
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+        for (const int fd : pipe_fds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+        ErrorCapture::instance = nullptr;
+    }
+
+    auto sendFromDevice(const std::string &data) const -> void
+    {
+        ASSERT_EQ(write(pty.master_fd, data.data(), data.size()), static_cast<ssize_t>(data.size()));
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    PtyPair pty;
+    int64_t handle = 0;
+    std::array<int, 2> pipe_fds{-1, -1};
+};
+
+TEST_F(SerialBridgeTest, InvalidArguments)
+{
+    EXPECT_EQ(serialBridgeStart(handle, pipe_fds[1], 0, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialBridgeStart(handle, pipe_fds[1], kSerialBridgeCopyOnly, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialBridgeStart(handle, -1, kSerialBridgeToFd, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialBridgeStart(handle, static_cast<int>(handle), kSerialBridgeToFd, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialBridgeStart(-1, pipe_fds[1], kSerialBridgeToFd, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kInvalidHandleError));
+
+    SerialBridgeStats stats{};
+    EXPECT_EQ(serialBridgeStats(12345, &stats, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialBridgeStop(12345, error_callback), static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(error_capture.last_message, "Unknown bridge");
+}
+
+TEST_F(SerialBridgeTest, ForwardsPortToPipe)
+{
+    const int64_t bridge = serialBridgeStart(handle, pipe_fds[1], kSerialBridgeToFd, error_callback);
+    ASSERT_GT(bridge, 0);
+
+    sendFromDevice("sensor line 1\n");
+    EXPECT_EQ(readFd(pipe_fds[0], 14), "sensor line 1\n");
+    sendFromDevice("sensor line 2\n");
+    EXPECT_EQ(readFd(pipe_fds[0], 14), "sensor line 2\n");
+
+    const SerialBridgeStats stats =
+        waitForStats(bridge, [](const SerialBridgeStats &s) { return s.bytes_to_fd >= 28; });
+    EXPECT_EQ(stats.bytes_to_fd, 28U);
+    EXPECT_EQ(stats.bytes_from_fd, 0U);
+    EXPECT_EQ(stats.active_directions, kSerialBridgeToFd);
+    EXPECT_EQ(stats.error_number, 0);
+    EXPECT_GT(stats.elapsed_ns, 0);
+    EXPECT_GT(stats.to_fd_bytes_per_sec, 0U);
+    EXPECT_EQ(serialBridgeStop(bridge, error_callback), 0);
+}
+
+TEST_F(SerialBridgeTest, ForwardsPipeToPortAndEndsAtEndOfFile)
+{
+    const int64_t bridge = serialBridgeStart(handle, pipe_fds[0], kSerialBridgeFromFd, error_callback);
+    ASSERT_GT(bridge, 0);
+
+    const std::string command = "AT+RESET\r\n";
+    ASSERT_EQ(write(pipe_fds[1], command.data(), command.size()), static_cast<ssize_t>(command.size()));
+    EXPECT_EQ(readFd(pty.master_fd, command.size()), command);
+
+    close(pipe_fds[1]);
+    pipe_fds[1] = -1;
+    const SerialBridgeStats stats =
+        waitForStats(bridge, [](const SerialBridgeStats &s) { return s.active_directions == 0; });
+    EXPECT_EQ(stats.active_directions, 0);
+    EXPECT_EQ(stats.error_number, 0);
+    EXPECT_EQ(stats.bytes_from_fd, command.size());
+    EXPECT_EQ(serialBridgeStop(bridge, error_callback), 0);
+}
+
+TEST_F(SerialBridgeTest, BothDirectionsOverASocket)
+{
+    std::array<int, 2> sockets{-1, -1};
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, sockets.data()), 0);
+    const int64_t bridge =
+        serialBridgeStart(handle, sockets[0], kSerialBridgeToFd | kSerialBridgeFromFd, error_callback);
+    ASSERT_GT(bridge, 0);
+
+    sendFromDevice("from device");
+    EXPECT_EQ(readFd(sockets[1], 11), "from device");
+    ASSERT_EQ(write(sockets[1], "from tool", 9), 9);
+    EXPECT_EQ(readFd(pty.master_fd, 9), "from tool");
+
+    const SerialBridgeStats stats = waitForStats(
+        bridge, [](const SerialBridgeStats &s) { return s.bytes_to_fd >= 11 && s.bytes_from_fd >= 9; });
+    EXPECT_EQ(stats.bytes_to_fd, 11U);
+    EXPECT_EQ(stats.bytes_from_fd, 9U);
+    EXPECT_EQ(stats.active_directions, kSerialBridgeToFd | kSerialBridgeFromFd);
+
+    // Closing the port stops its bridges.
+    EXPECT_EQ(serialClose(handle, error_callback), 0);
+    handle = 0;
+    SerialBridgeStats stats_after_close{};
+    EXPECT_EQ(serialBridgeStats(bridge, &stats_after_close, nullptr),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    close(sockets[0]);
+    close(sockets[1]);
+}
+
+TEST_F(SerialBridgeTest, CopyModeForwardsTheSameBytes)
+{
+    const int64_t bridge =
+        serialBridgeStart(handle, pipe_fds[1], kSerialBridgeToFd | kSerialBridgeCopyOnly, error_callback);
+    ASSERT_GT(bridge, 0);
+
+    std::string sent;
+    for (int i = 0; i < 64; ++i)
+    {
+        sent += "line " + std::to_string(i) + "\n";
+    }
+    sendFromDevice(sent);
+    EXPECT_EQ(readFd(pipe_fds[0], sent.size()), sent);
+
+    const SerialBridgeStats stats =
+        waitForStats(bridge, [&sent](const SerialBridgeStats &s) { return s.bytes_to_fd >= sent.size(); });
+    EXPECT_EQ(stats.bytes_to_fd, sent.size());
+    EXPECT_EQ(stats.spliced_bytes, 0U);
+    EXPECT_EQ(serialBridgeStop(bridge, error_callback), 0);
+}
@@ -1,10 +1,15 @@
+#include <cpp_bindings_linux/serial_port.hpp>
 #include <cpp_core/interface/serial_close.h>
 #include <cpp_core/status_codes.h>
 
+#include "detail/fd_bridge.hpp"
+#include "detail/port_registry.hpp"
 #include "detail/posix_helpers.hpp"
+#include "detail/read_fanout.hpp"
+#include "detail/reconnect_supervisor.hpp"
+#include "detail/write_pacer.hpp"
 
 #include <limits>
-#include <unistd.h>
 
 extern "C"
 {
@@ -22,9 +27,34 @@ extern "C"
         }
 
         const int fd = static_cast<int>(handle);
-        if (close(fd) != 0)
+
+        // Background threads (reconnect supervisor, write pacer, fan-out reader, bridges) must let go of the
+        // descriptor before its number can be reused.
+        auto *registered = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+        if (registered != nullptr && registered->reconnect.load(std::memory_order_relaxed))
+        {
+            cpp_bindings_linux::detail::ReconnectSupervisor::instance().remove(fd);
+        }
+        if (registered != nullptr && registered->paced.load(std::memory_order_relaxed))
+        {
+            cpp_bindings_linux::detail::WritePacer::instance().remove(fd);
+        }
+        if (registered != nullptr && registered->fanout.load(std::memory_order_relaxed))
+        {
+            cpp_bindings_linux::detail::FanoutReader::instance().remove(fd);
+        }
+        if (registered != nullptr && registered->bridged.load(std::memory_order_relaxed))
+        {
+            cpp_bindings_linux::detail::BridgeReactor::instance().removePort(fd);
+        }
+
+        // Per-port state goes first; the caller guarantees no other operation on this handle is still running.
+        const auto state = cpp_bindings_linux::detail::PortRegistry::instance().remove(fd);
+
+        const auto result = cpp_bindings_linux::SerialPort::adopt(fd).close();
+        if (!result)
         {
-            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kCloseHandleError);
+            return cpp_bindings_linux::detail::failError<int>(error_callback, result.error());
         }
 
         return static_cast<int>(cpp_core::StatusCodes::kSuccess);
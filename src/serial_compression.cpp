@@ -0,0 +1,77 @@
+#include <cpp_bindings_linux/interface/serial_compression.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/link_compression.hpp"
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <memory>
+#include <mutex>
+
+extern "C"
+{
+    MODULE_API auto serialSetCompression(int64_t handle, int enabled, ErrorCallbackT error_callback) -> int
+    {
+        if (enabled != 0 && enabled != 1)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid enabled: must be 0 or 1");
+        }
+
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        // Built outside the locks; the swap waits for in-flight reads and writes to finish.
+        auto reader = enabled != 0 ? std::make_unique<cpp_bindings_linux::detail::CompressedReader>() : nullptr;
+        auto writer = enabled != 0 ? std::make_unique<cpp_bindings_linux::detail::CompressedWriter>() : nullptr;
+        const std::scoped_lock side_locks(state->read.mutex, state->write.mutex);
+        if (enabled != 0 && (state->write.pacing != nullptr || state->read.fanout != nullptr))
+        {
+            // The write pacer and the fan-out reader move raw bytes and would bypass the framing.
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kSetStateError,
+                                                            "Disable write pacing and fan-out first");
+        }
+        state->read.compression.swap(reader);
+        state->write.compression.swap(writer);
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialGetCompressionStats(int64_t handle, SerialCompressionStats *stats,
+                                              ErrorCallbackT error_callback) -> int
+    {
+        if (stats == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid stats");
+        }
+
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        *stats = {};
+        {
+            const std::scoped_lock read_lock(state->read.mutex);
+            if (state->read.compression != nullptr)
+            {
+                stats->raw_rx_bytes = state->read.compression->raw_bytes;
+                stats->wire_rx_bytes = state->read.compression->wire_bytes;
+            }
+        }
+        {
+            const std::scoped_lock write_lock(state->write.mutex);
+            if (state->write.compression != nullptr)
+            {
+                stats->raw_tx_bytes = state->write.compression->raw_bytes;
+                stats->wire_tx_bytes = state->write.compression->wire_bytes;
+            }
+        }
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+} // extern "C"
@@ -0,0 +1,322 @@
+#include <cpp_bindings_linux/interface/serial_bridge.h>
+#include <cpp_bindings_linux/interface/serial_compression.h>
+#include <cpp_bindings_linux/interface/serial_crc.h>
+#include <cpp_bindings_linux/interface/serial_fanout.h>
+#include <cpp_bindings_linux/interface/serial_read_any.h>
+#include <cpp_bindings_linux/interface/serial_read_timestamped.h>
+#include <cpp_bindings_linux/interface/serial_submit.h>
+#include <cpp_bindings_linux/interface/serial_transact.h>
+#include <cpp_bindings_linux/interface/serial_write_all.h>
+#include <cpp_bindings_linux/interface/serial_write_pacing.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "detail/lz_stream.hpp"
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+auto telemetryRecord(int sequence) -> std::string
+{
+    std::array<char, 96> line{};
+    const int length = std::snprintf(line.data(), line.size(), "seq=%06d temp=%.1f hum=%d press=1013.%d status=OK\n",
+                                     sequence, 21.5 + (sequence % 7) * 0.1, 40 + (sequence % 3), sequence % 10);
+    return {line.data(), static_cast<std::size_t>(length)};
+}
+
+auto roundTrip(cpp_bindings_linux::detail::LzEncoder &encoder, cpp_bindings_linux::detail::LzDecoder &decoder,
+               const std::string &block) -> int
+{
+    std::vector<unsigned char> compressed(
+        static_cast<std::size_t>(cpp_bindings_linux::detail::lzCompressBound(static_cast<int>(block.size()))));
+    const int compressed_size = encoder.compress(reinterpret_cast<const unsigned char *>(block.data()),
+                                                 static_cast<int>(block.size()), compressed.data());
+
+    std::string decoded(block.size(), '\0');
+    EXPECT_TRUE(decoder.decompress(compressed.data(), compressed_size, static_cast<int>(block.size()),
+                                   reinterpret_cast<unsigned char *>(decoded.data())));
+    EXPECT_EQ(decoded, block);
+    return compressed_size;
+}
+
+auto readExactly(int64_t handle, std::string &out, std::size_t size) -> bool
+{
+    std::array<char, 512> buffer{};
+    while (out.size() < size)
+    {
+        const int bytes = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, nullptr);
+        if (bytes <= 0)
+        {
+            return false;
+        }
+        out.append(buffer.data(), static_cast<std::size_t>(bytes));
+    }
+    return true;
+}
+} // namespace
+
+TEST(LzStreamTest, RoundTripsAndUsesEarlierBlocksAsDictionary)
+{
+    cpp_bindings_linux::detail::LzEncoder encoder;
+    cpp_bindings_linux::detail::LzDecoder decoder;
+
+    const std::string first = telemetryRecord(1);
+    const int first_size = roundTrip(encoder, decoder, first);
+
+    // The second record alone has little redundancy; against the history it mostly becomes back references.
+    const std::string second = telemetryRecord(2);
+    const int second_size = roundTrip(encoder, decoder, second);
+    EXPECT_LT(second_size, first_size / 2);
+
+    for (int sequence = 3; sequence < 2000; ++sequence)
+    {
+        roundTrip(encoder, decoder, telemetryRecord(sequence));
+    }
+}
+
+TEST(LzStreamTest, RunsLongBlocksAndIncompressibleData)
+{
+    cpp_bindings_linux::detail::LzEncoder encoder;
+    cpp_bindings_linux::detail::LzDecoder decoder;
+
+    EXPECT_LT(roundTrip(encoder, decoder, std::string(cpp_bindings_linux::detail::kLzMaxBlockSize, 'a')), 40);
+
+    std::mt19937 rng(7);
+    std::string noise(cpp_bindings_linux::detail::kLzMaxBlockSize, '\0');
+    for (auto &byte : noise)
+    {
+        byte = static_cast<char>(rng());
+    }
+    EXPECT_LE(roundTrip(encoder, decoder, noise), cpp_bindings_linux::detail::lzCompressBound(
+                                                      static_cast<int>(noise.size())));
+}
+
+TEST(LzStreamTest, RejectsMalformedInput)
+{
+    cpp_bindings_linux::detail::LzDecoder decoder;
+    std::array<unsigned char, 16> out{};
+
+    // Match offset reaching before the start of the history.
+    const std::array<unsigned char, 4> bad_offset = {0x10, 'x', 0x05, 0x00};
+    EXPECT_FALSE(decoder.decompress(bad_offset.data(), static_cast<int>(bad_offset.size()), 8, out.data()));
+
+    decoder.reset();
+    // Literal run longer than the input.
+    const std::array<unsigned char, 2> short_literals = {0x50, 'x'};
+    EXPECT_FALSE(decoder.decompress(short_literals.data(), static_cast<int>(short_literals.size()), 5, out.data()));
+
+    decoder.reset();
+    // Decodes to fewer bytes than announced.
+    const std::array<unsigned char, 2> too_short = {0x10, 'x'};
+    EXPECT_FALSE(decoder.decompress(too_short.data(), static_cast<int>(too_short.size()), 2, out.data()));
+}
+
+class SerialCompressionTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+    }
+
+    void TearDown() override
+    {
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+};
+
+TEST_F(SerialCompressionTest, InvalidArguments)
+{
+    EXPECT_EQ(serialSetCompression(-1, 1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialSetCompression(1, 2, error_callback), static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialGetCompressionStats(1, nullptr, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+
+    SerialCompressionStats stats{};
+    EXPECT_EQ(serialGetCompressionStats(STDIN_FILENO + 1000, &stats, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(error_capture.last_message, "Handle was not opened with serialOpen");
+}
+
+TEST_F(SerialCompressionTest, TransparentBothWaysOverPty)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t host = pty.openSlave();
+    ASSERT_GT(host, 0);
+    const RegisteredMaster device_state(pty.master_fd);
+    const int64_t device = pty.master_fd;
+
+    ASSERT_EQ(serialSetCompression(host, 1, error_callback), 0);
+    ASSERT_EQ(serialSetCompression(device, 1, error_callback), 0);
+
+    std::string sent;
+    for (int sequence = 0; sequence < 200; ++sequence)
+    {
+        const std::string record = telemetryRecord(sequence);
+        ASSERT_EQ(serialWrite(device, record.data(), static_cast<int>(record.size()), 1000, 0, error_callback),
+                  static_cast<int>(record.size()));
+        sent += record;
+    }
+    std::string received;
+    ASSERT_TRUE(readExactly(host, received, sent.size()));
+    EXPECT_EQ(received, sent);
+
+    // Larger than one block, the other way round.
+    std::string bulk;
+    for (int sequence = 0; bulk.size() < 10000; ++sequence)
+    {
+        bulk += telemetryRecord(sequence);
+    }
+    ASSERT_EQ(serialWrite(host, bulk.data(), static_cast<int>(bulk.size()), 1000, 0, error_callback),
+              static_cast<int>(bulk.size()));
+    std::string echoed;
+    ASSERT_TRUE(readExactly(device, echoed, bulk.size()));
+    EXPECT_EQ(echoed, bulk);
+
+    SerialCompressionStats stats{};
+    ASSERT_EQ(serialGetCompressionStats(host, &stats, error_callback), 0);
+    EXPECT_EQ(stats.raw_rx_bytes, sent.size());
+    EXPECT_EQ(stats.raw_tx_bytes, bulk.size());
+    EXPECT_LT(stats.wire_rx_bytes * 2, stats.raw_rx_bytes);
+    EXPECT_LT(stats.wire_tx_bytes * 3, stats.raw_tx_bytes);
+
+    ASSERT_EQ(serialSetCompression(device, 0, error_callback), 0);
+    serialClose(host, nullptr);
+}
+
+TEST_F(SerialCompressionTest, CorruptFrameIsReported)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t host = pty.openSlave();
+    ASSERT_GT(host, 0);
+    ASSERT_EQ(serialSetCompression(host, 1, error_callback), 0);
+
+    // A plain (uncompressed) sender: its bytes are no valid frame.
+    ASSERT_EQ(write(pty.master_fd, "hello world\n", 12), 12);
+    ASSERT_TRUE(PtyPair::waitQueued(host, 12));
+
+    std::array<char, 64> buffer{};
+    EXPECT_EQ(serialRead(host, buffer.data(), static_cast<int>(buffer.size()), 100, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kReadError));
+    EXPECT_EQ(error_capture.last_message, "Compressed stream is corrupted; re-enable on both ends");
+
+    serialClose(host, nullptr);
+}
+
+TEST_F(SerialCompressionTest, WriteAllIsTranslated)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t host = pty.openSlave();
+    ASSERT_GT(host, 0);
+    const RegisteredMaster device_state(pty.master_fd);
+    const int64_t device = pty.master_fd;
+
+    ASSERT_EQ(serialSetCompression(host, 1, error_callback), 0);
+    ASSERT_EQ(serialSetCompression(device, 1, error_callback), 0);
+
+    std::string bulk;
+    for (int sequence = 0; bulk.size() < 10000; ++sequence)
+    {
+        bulk += telemetryRecord(sequence);
+    }
+    ASSERT_EQ(serialWriteAll(host, bulk.data(), static_cast<int>(bulk.size()), 1000, 0, error_callback),
+              static_cast<int>(bulk.size()));
+    std::string received;
+    ASSERT_TRUE(readExactly(device, received, bulk.size()));
+    EXPECT_EQ(received, bulk);
+
+    ASSERT_EQ(serialSetCompression(device, 0, error_callback), 0);
+    serialClose(host, nullptr);
+}
+
+TEST_F(SerialCompressionTest, RawWireCallsAreRefused)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t host = pty.openSlave();
+    ASSERT_GT(host, 0);
+    ASSERT_EQ(serialSetCompression(host, 1, error_callback), 0);
+
+    const auto read_error = static_cast<int>(cpp_core::StatusCodes::kReadError);
+    const auto write_error = static_cast<int>(cpp_core::StatusCodes::kWriteError);
+    std::array<char, 64> buffer{};
+    const int size = static_cast<int>(buffer.size());
+
+    EXPECT_EQ(serialWriteWithCrc(host, buffer.data(), 8, 100, 0, kSerialCrc16Modbus, error_callback), write_error);
+    EXPECT_EQ(error_capture.last_message, "Handle is in compressed-stream mode; use serialWrite");
+    EXPECT_EQ(serialReadWithCrc(host, buffer.data(), size, 0, 0, kSerialCrc16Modbus, error_callback), read_error);
+    EXPECT_EQ(error_capture.last_message, "Handle is in compressed-stream mode; use serialRead");
+
+    std::array<SerialRxTimestamp, 4> timestamps{};
+    int timestamp_count = 0;
+    EXPECT_EQ(serialReadTimestamped(host, buffer.data(), size, 0, 0, timestamps.data(),
+                                    static_cast<int>(timestamps.size()), &timestamp_count, error_callback),
+              read_error);
+
+    SerialTransaction transaction{"ping", buffer.data(), 4, size, 0, '\n', 0, 0};
+    EXPECT_EQ(serialTransact(host, &transaction, 1, 1, 0, 100, error_callback), write_error);
+
+    std::array<SerialOperation, 2> operations = {{
+        {host, kSerialOperationRead, size, buffer.data(), 0, 0},
+        {host, kSerialOperationWrite, 4, buffer.data(), 0, 0},
+    }};
+    std::array<int32_t, 2> results{};
+    EXPECT_EQ(serialSubmit(operations.data(), results.data(), 2, error_callback), 0);
+    EXPECT_EQ(results[0], read_error);
+    EXPECT_EQ(results[1], write_error);
+
+    // serialReadAny() only looks at handles with data waiting.
+    ASSERT_EQ(write(pty.master_fd, "raw", 3), 3);
+    ASSERT_TRUE(PtyPair::waitQueued(host, 3));
+    void *const buffers[] = {buffer.data()};
+    SerialReadAnyResult any{};
+    EXPECT_EQ(serialReadAny(&host, buffers, &size, 1, &any, 100, error_callback), 1);
+    EXPECT_EQ(any.bytes_read, read_error);
+
+    EXPECT_EQ(serialBridgeStart(host, pty.master_fd, kSerialBridgeToFd, error_callback), read_error);
+    EXPECT_EQ(serialSetWritePacing(host, 20, 4096, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kSetStateError));
+    EXPECT_EQ(serialSetFanout(host, 4096, kSerialFanoutDrop, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kSetStateError));
+
+    // The other way round: the mode cannot start under the write pacer.
+    ASSERT_EQ(serialSetCompression(host, 0, error_callback), 0);
+    ASSERT_EQ(serialSetWritePacing(host, 20, 4096, error_callback), 0);
+    EXPECT_EQ(serialSetCompression(host, 1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kSetStateError));
+    EXPECT_EQ(error_capture.last_message, "Disable write pacing and fan-out first");
+
+    serialClose(host, nullptr);
+}
@@ -0,0 +1,215 @@
+#include <cpp_bindings_linux/interface/serial_crc.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/crc.hpp"
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+#include "detail/read_loop.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <limits>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace
+{
+// Modbus RTU ends a frame at a silence of 3.5 character times, fixed at 1750 µs above 19200 baud. Descriptors
+// without port state (no known baud rate) get the fixed value.
+constexpr int64_t kMinFrameGapNs = 1'750'000;
+
+auto frameGapNs(const cpp_bindings_linux::detail::PortState *state) -> int64_t
+{
+    const int64_t character_ns = state != nullptr ? state->config.nsPerByte() : 0;
+    return std::max((character_ns * 7) / 2, kMinFrameGapNs);
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialCrc(int crc_kind, const void *data, int size, ErrorCallbackT error_callback) -> int64_t
+    {
+        if (!cpp_bindings_linux::detail::isValidCrcKind(crc_kind))
+        {
+            return cpp_bindings_linux::detail::failMsg<int64_t>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid crc_kind");
+        }
+
+        if ((data == nullptr && size != 0) || size < 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int64_t>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid data or size");
+        }
+
+        return cpp_bindings_linux::detail::crcCompute(static_cast<cpp_bindings_linux::detail::CrcKind>(crc_kind),
+                                                      static_cast<const unsigned char *>(data),
+                                                      static_cast<std::size_t>(size));
+    }
+
+    MODULE_API auto serialWriteWithCrc(int64_t handle, const void *buffer, int buffer_size, int timeout_ms,
+                                       int /*multiplier*/, int crc_kind, ErrorCallbackT error_callback) -> int
+    {
+        if (buffer == nullptr || buffer_size <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer or buffer_size");
+        }
+
+        if (!cpp_bindings_linux::detail::isValidCrcKind(crc_kind))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid crc_kind");
+        }
+
+        if (handle <= 0 || handle > std::numeric_limits<int>::max())
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                            "Invalid handle");
+        }
+
+        if (timeout_ms < 0)
+        {
+            timeout_ms = 0;
+        }
+
+        const int fd = static_cast<int>(handle);
+        const auto kind = static_cast<cpp_bindings_linux::detail::CrcKind>(crc_kind);
+
+        std::array<unsigned char, 4> trailer{};
+        cpp_bindings_linux::detail::crcStore(
+            kind,
+            cpp_bindings_linux::detail::crcCompute(kind, static_cast<const unsigned char *>(buffer),
+                                                   static_cast<std::size_t>(buffer_size)),
+            trailer.data());
+
+        // Payload and trailer leave in one syscall, so the frame is never split by an unrelated writer.
+        const std::array<struct iovec, 2> parts = {{
+            {const_cast<void *>(buffer), static_cast<size_t>(buffer_size)},
+            {trailer.data(), static_cast<size_t>(cpp_bindings_linux::detail::crcWidthBytes(kind))},
+        }};
+
+        auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+        const auto side_lock = cpp_bindings_linux::detail::lockWriteSide(state);
+        if (cpp_bindings_linux::detail::rejectCompressedWrite(state, error_callback))
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kWriteError);
+        }
+
+        ssize_t bytes_written = ::writev(fd, parts.data(), static_cast<int>(parts.size()));
+        if (bytes_written < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                const int ready = cpp_bindings_linux::detail::waitFdReady(fd, timeout_ms, false);
+                if (ready < 0)
+                {
+                    return cpp_bindings_linux::detail::failErrno<int>(error_callback,
+                                                                      cpp_core::StatusCodes::kWriteError);
+                }
+                if (ready == 0)
+                {
+                    return 0;
+                }
+                bytes_written = ::writev(fd, parts.data(), static_cast<int>(parts.size()));
+            }
+
+            if (bytes_written < 0)
+            {
+                return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kWriteError);
+            }
+        }
+
+        tcdrain(fd);
+        cpp_bindings_linux::detail::recordWrite(state, bytes_written);
+
+        return static_cast<int>(bytes_written);
+    }
+
+    MODULE_API auto serialReadWithCrc(int64_t handle, void *buffer, int buffer_size, int timeout_ms,
+                                      int /*multiplier*/, int crc_kind, ErrorCallbackT error_callback) -> int
+    {
+        if (buffer == nullptr || buffer_size <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer or buffer_size");
+        }
+
+        if (!cpp_bindings_linux::detail::isValidCrcKind(crc_kind))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid crc_kind");
+        }
+
+        if (handle <= 0 || handle > std::numeric_limits<int>::max())
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                            "Invalid handle");
+        }
+
+        if (timeout_ms < 0)
+        {
+            timeout_ms = 0;
+        }
+
+        const int fd = static_cast<int>(handle);
+        auto *buf = static_cast<unsigned char *>(buffer);
+        const auto kind = static_cast<cpp_bindings_linux::detail::CrcKind>(crc_kind);
+
+        auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+        const auto side_lock = cpp_bindings_linux::detail::lockReadSide(state);
+        if (cpp_bindings_linux::detail::rejectFanoutRead(state, error_callback) ||
+            cpp_bindings_linux::detail::rejectCompressedRead(state, error_callback))
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kReadError);
+        }
+
+        // The first byte may take up to timeout_ms; after it, the frame is whatever arrives until the line has
+        // been quiet for one frame gap (or the buffer is full), however the driver splits it into reads.
+        cpp_bindings_linux::detail::NoReadObserver observer;
+        const int64_t gap_ns = frameGapNs(state);
+        ssize_t total_read = cpp_bindings_linux::detail::takeCarried(state, buf, buffer_size);
+        if (total_read == 0)
+        {
+            total_read = cpp_bindings_linux::detail::readWithTimeout(fd, buf, buffer_size, timeout_ms, observer);
+        }
+        while (total_read > 0 && total_read < buffer_size)
+        {
+            const ssize_t bytes = cpp_bindings_linux::detail::readWithTimeoutNs(
+                fd, buf + total_read, buffer_size - static_cast<int>(total_read), gap_ns, observer);
+            if (bytes == 0)
+            {
+                break;
+            }
+            total_read = bytes < 0 ? bytes : total_read + bytes;
+        }
+        if (total_read < 0)
+        {
+            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
+        }
+        cpp_bindings_linux::detail::recordRead(state, total_read);
+        if (total_read == 0)
+        {
+            return 0;
+        }
+
+        const int width = cpp_bindings_linux::detail::crcWidthBytes(kind);
+        if (total_read <= width)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kReadError,
+                                                            "Frame too short for CRC");
+        }
+
+        const auto payload_size = static_cast<std::size_t>(total_read - width);
+        if (cpp_bindings_linux::detail::crcCompute(kind, buf, payload_size) !=
+            cpp_bindings_linux::detail::crcLoad(kind, buf + payload_size))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kReadError,
+                                                            "CRC mismatch");
+        }
+
+        return static_cast<int>(payload_size);
+    }
+
+} // extern "C"
@@ -0,0 +1,186 @@
+#include <cpp_bindings_linux/interface/serial_crc.h>
+#include <cpp_core/status_codes.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <random>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "detail/crc.hpp"
+#include "test_helpers/error_capture.hpp"
+
+namespace
+{
+constexpr const char *kCheckInput = "123456789";
+constexpr int kCheckInputSize = 9;
+} // namespace
+
+class SerialCrcTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        ASSERT_EQ(pipe(pipefd.data()), 0);
+        fcntl(pipefd[0], F_SETFL, O_NONBLOCK);
+        fcntl(pipefd[1], F_SETFL, O_NONBLOCK);
+    }
+
+    void TearDown() override
+    {
+        close(pipefd[0]);
+        close(pipefd[1]);
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    std::array<int, 2> pipefd{};
+};
+
+TEST_F(SerialCrcTest, CatalogueCheckValues)
+{
+    EXPECT_EQ(serialCrc(kSerialCrc16Modbus, kCheckInput, kCheckInputSize, error_callback), 0x4B37);
+    EXPECT_EQ(serialCrc(kSerialCrc16Ccitt, kCheckInput, kCheckInputSize, error_callback), 0x29B1);
+    EXPECT_EQ(serialCrc(kSerialCrc32, kCheckInput, kCheckInputSize, error_callback), 0xCBF43926);
+    EXPECT_EQ(serialCrc(kSerialCrc32c, kCheckInput, kCheckInputSize, error_callback), 0xE3069283);
+}
+
+TEST_F(SerialCrcTest, InvalidArguments)
+{
+    EXPECT_EQ(serialCrc(42, kCheckInput, kCheckInputSize, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialCrc(kSerialCrc32, nullptr, 4, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialCrc(kSerialCrc32, kCheckInput, -1, error_callback),
+              static_cast<int64_t>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialCrcTest, KernelsAgreeOnAllLengths)
+{
+    using namespace cpp_bindings_linux::detail;
+
+    std::mt19937 rng(1234);
+    std::vector<unsigned char> data(1100);
+    for (auto &byte : data)
+    {
+        byte = static_cast<unsigned char>(rng());
+    }
+
+    for (std::size_t size = 0; size <= data.size(); ++size)
+    {
+        const unsigned char *ptr = data.data();
+        ASSERT_EQ(crc16ModbusSlice8(ptr, size), crc16ModbusBytewise(ptr, size)) << "size " << size;
+        ASSERT_EQ(crc16CcittSlice8(ptr, size), crc16CcittBytewise(ptr, size)) << "size " << size;
+        ASSERT_EQ(crc32Slice8(ptr, size), crc32Bytewise(ptr, size)) << "size " << size;
+        ASSERT_EQ(crc32cSlice8(ptr, size), crc32cBytewise(ptr, size)) << "size " << size;
+        if (hasCrc32Pclmul())
+        {
+            ASSERT_EQ(crc32Pclmul(ptr, size), crc32Bytewise(ptr, size)) << "size " << size;
+        }
+        if (hasCrc32cSse42())
+        {
+            ASSERT_EQ(crc32cSse42(ptr, size), crc32cBytewise(ptr, size)) << "size " << size;
+        }
+    }
+}
+
+TEST_F(SerialCrcTest, WriteAppendsModbusTrailer)
+{
+    const std::array<unsigned char, 6> request = {0x01, 0x03, 0x00, 0x00, 0x00, 0x0A};
+    int written = serialWriteWithCrc(pipefd[1], request.data(), static_cast<int>(request.size()), 100, 0,
+                                     kSerialCrc16Modbus, error_callback);
+    ASSERT_EQ(written, 8);
+
+    std::array<unsigned char, 16> frame{};
+    ASSERT_EQ(read(pipefd[0], frame.data(), frame.size()), 8);
+    // Well-known Modbus RTU "read holding registers" request: CRC C5 CD, low byte first.
+    EXPECT_EQ(frame[6], 0xC5);
+    EXPECT_EQ(frame[7], 0xCD);
+}
+
+TEST_F(SerialCrcTest, RoundTripValidates)
+{
+    for (int kind : {kSerialCrc16Modbus, kSerialCrc16Ccitt, kSerialCrc32, kSerialCrc32c})
+    {
+        const std::string payload = "payload-" + std::to_string(kind);
+        int written = serialWriteWithCrc(pipefd[1], payload.data(), static_cast<int>(payload.size()), 100, 0, kind,
+                                         error_callback);
+        ASSERT_GT(written, static_cast<int>(payload.size()));
+
+        std::array<char, 64> buffer{};
+        int payload_size =
+            serialReadWithCrc(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 100, 0, kind, error_callback);
+        ASSERT_EQ(payload_size, static_cast<int>(payload.size())) << "kind " << kind;
+        EXPECT_EQ(std::string(buffer.data(), payload.size()), payload);
+    }
+}
+
+TEST_F(SerialCrcTest, ReadCollectsAFrameThatArrivesInPieces)
+{
+    // The Modbus request from above, split the way a slow UART delivers it: the pieces are closer together than
+    // the frame gap, so they make up one frame. The next frame follows after a longer pause and stays queued.
+    const std::array<unsigned char, 8> frame = {0x01, 0x03, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0xCD};
+    std::thread device([&] {
+        for (std::size_t offset = 0; offset < frame.size(); offset += 3)
+        {
+            const std::size_t size = std::min<std::size_t>(3, frame.size() - offset);
+            ASSERT_EQ(write(pipefd[1], frame.data() + offset, size), static_cast<ssize_t>(size));
+            std::this_thread::sleep_for(std::chrono::microseconds(300));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_EQ(write(pipefd[1], frame.data(), frame.size()), static_cast<ssize_t>(frame.size()));
+    });
+
+    std::array<unsigned char, 64> buffer{};
+    EXPECT_EQ(serialReadWithCrc(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 1000, 0,
+                                kSerialCrc16Modbus, error_callback),
+              6);
+    EXPECT_EQ(serialReadWithCrc(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 1000, 0,
+                                kSerialCrc16Modbus, error_callback),
+              6);
+    device.join();
+}
+
+TEST_F(SerialCrcTest, ReadDetectsCorruption)
+{
+    const std::array<unsigned char, 8> frame = {0x01, 0x03, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0xCE};
+    ASSERT_EQ(write(pipefd[1], frame.data(), frame.size()), 8);
+
+    std::array<unsigned char, 16> buffer{};
+    int result = serialReadWithCrc(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 100, 0,
+                                   kSerialCrc16Modbus, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kReadError));
+    EXPECT_NE(error_capture.last_message.find("CRC"), std::string::npos);
+}
+
+TEST_F(SerialCrcTest, ReadRejectsShortFrame)
+{
+    ASSERT_EQ(write(pipefd[1], "ab", 2), 2);
+
+    std::array<char, 16> buffer{};
+    int result = serialReadWithCrc(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 100, 0, kSerialCrc32,
+                                   error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kReadError));
+}
+
+TEST_F(SerialCrcTest, ReadTimeoutReturnsZero)
+{
+    std::array<char, 16> buffer{};
+    int result = serialReadWithCrc(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 10, 0, kSerialCrc32,
+                                   error_callback);
+
+    EXPECT_EQ(result, 0);
+}
@@ -0,0 +1,234 @@
+#include <cpp_bindings_linux/interface/serial_fanout.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+#include "detail/read_fanout.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+constexpr int kMaxBufferCapacity = 16 * 1024 * 1024;
+
+// Looks up the fan-out buffer and the subscriber's cursor; called with the read-side mutex held.
+auto findCursor(cpp_bindings_linux::detail::PortState &state, int64_t subscriber, ErrorCallbackT error_callback,
+                cpp_bindings_linux::detail::FanoutBuffer::Cursor *&cursor) -> int
+{
+    auto *buffer = state.read.fanout.get();
+    if (buffer == nullptr)
+    {
+        return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kReadError,
+                                                        "Fan-out is not enabled");
+    }
+    const auto entry = buffer->cursors.find(subscriber);
+    if (entry == buffer->cursors.end())
+    {
+        return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                        "Unknown subscriber");
+    }
+    cursor = &entry->second;
+    return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialSetFanout(int64_t handle, int buffer_capacity, int policy, ErrorCallbackT error_callback)
+        -> int
+    {
+        if (buffer_capacity < 0 || buffer_capacity > kMaxBufferCapacity)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer_capacity: must be 0 .. 16 MiB");
+        }
+        if (buffer_capacity > 0 && policy != kSerialFanoutDrop && policy != kSerialFanoutBlock)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid policy");
+        }
+
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+        const int fd = static_cast<int>(handle);
+        auto &reader = cpp_bindings_linux::detail::FanoutReader::instance();
+
+        // The thread is running before the buffer appears, so subscribers calling wake() always reach it.
+        if (buffer_capacity > 0 && !state->fanout.exchange(true))
+        {
+            const auto added = reader.add(fd);
+            if (!added)
+            {
+                state->fanout.store(false);
+                return cpp_bindings_linux::detail::failError<int>(error_callback, added.error());
+            }
+        }
+
+        // Built outside the lock; the swap waits for an in-flight read to finish.
+        auto buffer = buffer_capacity > 0 ? std::make_unique<cpp_bindings_linux::detail::FanoutBuffer>(
+                                                static_cast<std::size_t>(buffer_capacity), policy == kSerialFanoutBlock)
+                                          : nullptr;
+        bool compressed = false;
+        {
+            const std::scoped_lock read_lock(state->read.mutex);
+            compressed = buffer != nullptr && state->read.compression != nullptr;
+            if (!compressed)
+            {
+                state->read.fanout.swap(buffer);
+                // Nobody is subscribed yet, and bytes that arrive with no subscriber are discarded.
+                cpp_bindings_linux::detail::dropCarried(state);
+                if (buffer != nullptr)
+                {
+                    buffer->data.notify_all(); // readers waiting on the old buffer re-check and find it gone
+                }
+            }
+        }
+        if (compressed)
+        {
+            // The fan-out reader hands raw bytes to subscribers; see serialSetCompression().
+            if (state->fanout.exchange(false))
+            {
+                reader.remove(fd);
+            }
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kSetStateError,
+                                                            "Handle is in compressed-stream mode");
+        }
+
+        if (buffer_capacity == 0)
+        {
+            if (state->fanout.exchange(false))
+            {
+                reader.remove(fd);
+            }
+            return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+        }
+        reader.wake();
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialFanoutSubscribe(int64_t handle, ErrorCallbackT error_callback) -> int64_t
+    {
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int64_t>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        const std::scoped_lock read_lock(state->read.mutex);
+        auto *buffer = state->read.fanout.get();
+        if (buffer == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int64_t>(error_callback, cpp_core::StatusCodes::kReadError,
+                                                                "Fan-out is not enabled");
+        }
+        const int64_t subscriber = buffer->next_subscriber++;
+        buffer->cursors.emplace(subscriber, cpp_bindings_linux::detail::FanoutBuffer::Cursor{buffer->head, 0});
+        return subscriber;
+    }
+
+    MODULE_API auto serialFanoutUnsubscribe(int64_t handle, int64_t subscriber, ErrorCallbackT error_callback)
+        -> int
+    {
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        const std::scoped_lock read_lock(state->read.mutex);
+        cpp_bindings_linux::detail::FanoutBuffer::Cursor *cursor = nullptr;
+        const int status = findCursor(*state, subscriber, error_callback, cursor);
+        if (status != 0)
+        {
+            return status;
+        }
+        auto &buffer = *state->read.fanout;
+        const bool was_full = buffer.freeSpace() == 0;
+        buffer.cursors.erase(subscriber);
+        if (buffer.block && was_full)
+        {
+            cpp_bindings_linux::detail::FanoutReader::instance().wake();
+        }
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialFanoutRead(int64_t handle, int64_t subscriber, void *buffer, int buffer_size,
+                                     int timeout_ms, ErrorCallbackT error_callback) -> int
+    {
+        if (buffer == nullptr || buffer_size <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer or buffer_size");
+        }
+
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        const cpp_bindings_linux::detail::Deadline deadline(std::max(timeout_ms, 0));
+        std::unique_lock<std::mutex> lock(state->read.mutex);
+        while (true)
+        {
+            // Looked up on every pass: the buffer may have been replaced or removed while we waited.
+            cpp_bindings_linux::detail::FanoutBuffer::Cursor *cursor = nullptr;
+            const int status = findCursor(*state, subscriber, error_callback, cursor);
+            if (status != 0)
+            {
+                return status;
+            }
+            auto &shared = *state->read.fanout;
+
+            if (shared.head != cursor->position)
+            {
+                const bool was_full = shared.freeSpace() == 0;
+                const std::size_t count = shared.take(*cursor, static_cast<unsigned char *>(buffer),
+                                                      static_cast<std::size_t>(buffer_size));
+                if (shared.block && was_full)
+                {
+                    cpp_bindings_linux::detail::FanoutReader::instance().wake();
+                }
+                return static_cast<int>(count);
+            }
+            if (shared.error_number != 0)
+            {
+                errno = shared.error_number;
+                return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
+            }
+
+            const int remaining_ms = deadline.remainingMs();
+            if (remaining_ms == 0)
+            {
+                return 0;
+            }
+            shared.data.wait_for(lock, std::chrono::milliseconds(remaining_ms));
+        }
+    }
+
+    MODULE_API auto serialFanoutDropped(int64_t handle, int64_t subscriber, ErrorCallbackT error_callback) -> int64_t
+    {
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int64_t>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        const std::scoped_lock read_lock(state->read.mutex);
+        cpp_bindings_linux::detail::FanoutBuffer::Cursor *cursor = nullptr;
+        const int status = findCursor(*state, subscriber, error_callback, cursor);
+        if (status != 0)
+        {
+            return status;
+        }
+        return static_cast<int64_t>(cursor->dropped);
+    }
+
+} // extern "C"
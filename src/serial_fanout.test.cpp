@@ -0,0 +1,234 @@
+#include <cpp_bindings_linux/interface/serial_bridge.h>
+#include <cpp_bindings_linux/interface/serial_crc.h>
+#include <cpp_bindings_linux/interface/serial_fanout.h>
+#include <cpp_bindings_linux/interface/serial_read_timestamped.h>
+#include <cpp_bindings_linux/interface/serial_submit.h>
+#include <cpp_bindings_linux/interface/serial_transact.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/status_codes.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+// Reads until size bytes arrived for the subscriber, or a read times out.
+auto readFor(int64_t handle, int64_t subscriber, std::size_t size, int timeout_ms = 500) -> std::string
+{
+    std::string out;
+    std::array<char, 256> buffer{};
+    while (out.size() < size)
+    {
+        const int chunk = static_cast<int>(std::min(buffer.size(), size - out.size()));
+        const int bytes = serialFanoutRead(handle, subscriber, buffer.data(), chunk, timeout_ms, nullptr);
+        if (bytes <= 0)
+        {
+            break;
+        }
+        out.append(buffer.data(), static_cast<std::size_t>(bytes));
+    }
+    return out;
+}
+} // namespace
+
+class SerialFanoutTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        handle = pty.openSlave();
+        ASSERT_GT(handle, 0);
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+        ErrorCapture::instance = nullptr;
+    }
+
+    auto sendFromDevice(const std::string &data) const -> void
+    {
+        ASSERT_EQ(write(pty.master_fd, data.data(), data.size()), static_cast<ssize_t>(data.size()));
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    PtyPair pty;
+    int64_t handle = 0;
+    std::array<char, 64> buffer{};
+};
+
+TEST_F(SerialFanoutTest, InvalidArguments)
+{
+    EXPECT_EQ(serialSetFanout(handle, -1, kSerialFanoutDrop, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSetFanout(handle, 64, 7, error_callback), static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSetFanout(-1, 64, kSerialFanoutDrop, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+
+    // Not enabled yet.
+    EXPECT_EQ(serialFanoutSubscribe(handle, error_callback), static_cast<int64_t>(cpp_core::StatusCodes::kReadError));
+
+    ASSERT_EQ(serialSetFanout(handle, 64, kSerialFanoutDrop, error_callback), 0);
+    EXPECT_EQ(serialFanoutRead(handle, 99, buffer.data(), static_cast<int>(buffer.size()), 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialFanoutUnsubscribe(handle, 99, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialFanoutRead(handle, 1, nullptr, 16, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(error_capture.last_message, "Invalid buffer or buffer_size");
+}
+
+TEST_F(SerialFanoutTest, EverySubscriberSeesTheWholeStream)
+{
+    ASSERT_EQ(serialSetFanout(handle, 4096, kSerialFanoutDrop, error_callback), 0);
+    const int64_t logger = serialFanoutSubscribe(handle, error_callback);
+    const int64_t decoder = serialFanoutSubscribe(handle, error_callback);
+    const int64_t monitor = serialFanoutSubscribe(handle, error_callback);
+    ASSERT_GT(logger, 0);
+    ASSERT_GT(decoder, 0);
+    ASSERT_GT(monitor, 0);
+    EXPECT_NE(logger, decoder);
+
+    sendFromDevice("frame-1;frame-2;");
+    EXPECT_EQ(readFor(handle, logger, 16), "frame-1;frame-2;");
+    EXPECT_EQ(readFor(handle, decoder, 8), "frame-1;");
+    sendFromDevice("frame-3;");
+    EXPECT_EQ(readFor(handle, decoder, 16), "frame-2;frame-3;");
+    EXPECT_EQ(readFor(handle, monitor, 24), "frame-1;frame-2;frame-3;");
+    EXPECT_EQ(readFor(handle, logger, 8), "frame-3;");
+
+    // Caught up: nothing more, and a late subscriber only sees what comes next.
+    EXPECT_EQ(serialFanoutRead(handle, logger, buffer.data(), static_cast<int>(buffer.size()), 10, error_callback),
+              0);
+    const int64_t late = serialFanoutSubscribe(handle, error_callback);
+    sendFromDevice("frame-4;");
+    EXPECT_EQ(readFor(handle, late, 8), "frame-4;");
+    EXPECT_EQ(serialFanoutDropped(handle, monitor, error_callback), 0);
+}
+
+TEST_F(SerialFanoutTest, PlainReadsAreRejectedWhileEnabled)
+{
+    ASSERT_EQ(serialSetFanout(handle, 64, kSerialFanoutDrop, error_callback), 0);
+    EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kReadError));
+    EXPECT_EQ(error_capture.last_message, "Handle is in fan-out mode; use serialFanoutRead");
+
+    // Disabling hands the stream back to serialRead() and drops the subscribers.
+    const int64_t subscriber = serialFanoutSubscribe(handle, error_callback);
+    ASSERT_EQ(serialSetFanout(handle, 0, 0, error_callback), 0);
+    EXPECT_EQ(serialFanoutRead(handle, subscriber, buffer.data(), static_cast<int>(buffer.size()), 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kReadError));
+    sendFromDevice("direct");
+    ASSERT_TRUE(PtyPair::waitQueued(handle, 6));
+    EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, error_callback), 6);
+}
+
+TEST_F(SerialFanoutTest, OtherReadPathsAreRejectedWhileEnabled)
+{
+    ASSERT_EQ(serialSetFanout(handle, 64, kSerialFanoutDrop, error_callback), 0);
+    const auto read_error = static_cast<int>(cpp_core::StatusCodes::kReadError);
+    const int size = static_cast<int>(buffer.size());
+
+    EXPECT_EQ(serialReadWithCrc(handle, buffer.data(), size, 0, 0, kSerialCrc16Modbus, error_callback), read_error);
+    EXPECT_EQ(error_capture.last_message, "Handle is in fan-out mode; use serialFanoutRead");
+
+    std::array<SerialRxTimestamp, 4> timestamps{};
+    int timestamp_count = 0;
+    EXPECT_EQ(serialReadTimestamped(handle, buffer.data(), size, 0, 0, timestamps.data(),
+                                    static_cast<int>(timestamps.size()), &timestamp_count, error_callback),
+              read_error);
+
+    SerialTransaction transaction{nullptr, buffer.data(), 0, size, 0, '\n', 0, 0};
+    EXPECT_EQ(serialTransact(handle, &transaction, 1, 1, 0, 0, error_callback), read_error);
+
+    const SerialOperation operation{handle, kSerialOperationRead, size, buffer.data(), 0, 0};
+    int32_t result = 0;
+    EXPECT_EQ(serialSubmit(&operation, &result, 1, error_callback), 0);
+    EXPECT_EQ(result, read_error);
+
+    EXPECT_EQ(serialBridgeStart(handle, pty.master_fd, kSerialBridgeToFd, error_callback), read_error);
+}
+
+TEST_F(SerialFanoutTest, DropPolicySkipsAheadForASlowSubscriber)
+{
+    ASSERT_EQ(serialSetFanout(handle, 16, kSerialFanoutDrop, error_callback), 0);
+    const int64_t fast = serialFanoutSubscribe(handle, error_callback);
+    const int64_t slow = serialFanoutSubscribe(handle, error_callback);
+
+    std::string sent;
+    for (char block = 'a'; block < 'f'; ++block)
+    {
+        const std::string chunk(8, block);
+        sendFromDevice(chunk);
+        sent += chunk;
+        ASSERT_EQ(readFor(handle, fast, 8), chunk);
+    }
+
+    // The slow subscriber only finds the newest buffer's worth; the rest is counted as dropped.
+    EXPECT_EQ(readFor(handle, slow, 16, 10), sent.substr(sent.size() - 16));
+    EXPECT_EQ(serialFanoutDropped(handle, slow, error_callback), static_cast<int64_t>(sent.size() - 16));
+    EXPECT_EQ(serialFanoutDropped(handle, fast, error_callback), 0);
+}
+
+TEST_F(SerialFanoutTest, BlockPolicyWaitsForTheSlowestSubscriber)
+{
+    ASSERT_EQ(serialSetFanout(handle, 16, kSerialFanoutBlock, error_callback), 0);
+    const int64_t fast = serialFanoutSubscribe(handle, error_callback);
+    const int64_t slow = serialFanoutSubscribe(handle, error_callback);
+
+    const std::string sent = "0123456789abcdefghijklmnopqrstuvwxyzABCD";
+    sendFromDevice(sent);
+
+    // The buffer fills up and stays full until the slow subscriber reads; then the port is read again.
+    std::string fast_received = readFor(handle, fast, sent.size(), 50);
+    EXPECT_EQ(fast_received, sent.substr(0, 16));
+    std::string slow_received;
+    while (slow_received.size() < sent.size())
+    {
+        const std::string part = readFor(handle, slow, std::min<std::size_t>(16, sent.size() - slow_received.size()));
+        ASSERT_FALSE(part.empty());
+        slow_received += part;
+        fast_received += readFor(handle, fast, sent.size() - fast_received.size(), 50);
+    }
+    EXPECT_EQ(fast_received, sent);
+    EXPECT_EQ(slow_received, sent);
+    EXPECT_EQ(serialFanoutDropped(handle, slow, error_callback), 0);
+    EXPECT_EQ(serialFanoutDropped(handle, fast, error_callback), 0);
+}
+
+TEST_F(SerialFanoutTest, HangupIsReportedToEverySubscriber)
+{
+    ASSERT_EQ(serialSetFanout(handle, 64, kSerialFanoutDrop, error_callback), 0);
+    const int64_t first = serialFanoutSubscribe(handle, error_callback);
+    const int64_t second = serialFanoutSubscribe(handle, error_callback);
+
+    sendFromDevice("last");
+    ASSERT_EQ(readFor(handle, first, 4), "last");
+    close(pty.master_fd);
+    pty.master_fd = -1;
+
+    // Bytes received before the hangup are still delivered first.
+    EXPECT_EQ(readFor(handle, second, 4), "last");
+    EXPECT_LT(serialFanoutRead(handle, first, buffer.data(), static_cast<int>(buffer.size()), 500, error_callback), 0);
+    EXPECT_LT(serialFanoutRead(handle, second, buffer.data(), static_cast<int>(buffer.size()), 500, error_callback),
+              0);
+}
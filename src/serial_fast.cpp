@@ -0,0 +1,72 @@
+#include <cpp_bindings_linux/interface/serial_fast.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_open.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace
+{
+struct LastError
+{
+    int32_t code = 0;
+    std::array<char, 256> message{};
+};
+
+thread_local LastError last_error;
+
+// Passed as the error callback of the regular entry points; runs on the failing thread and never allocates.
+auto recordLastError(int code, const char *message) -> void
+{
+    last_error.code = code;
+    const std::size_t length =
+        message != nullptr ? std::min(std::strlen(message), last_error.message.size() - 1) : std::size_t{0};
+    if (length > 0)
+    {
+        std::memcpy(last_error.message.data(), message, length);
+    }
+    last_error.message[length] = '\0';
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialFastOpen(const char *port, int32_t baudrate, int32_t data_bits, int32_t parity,
+                                   int32_t stop_bits) -> int32_t
+    {
+        return static_cast<int32_t>(serialOpen(const_cast<char *>(port), baudrate, data_bits, parity, stop_bits,
+                                               &recordLastError));
+    }
+
+    MODULE_API auto serialFastClose(int32_t handle) -> int32_t
+    {
+        return serialClose(handle, &recordLastError);
+    }
+
+    MODULE_API auto serialFastRead(int32_t handle, void *buffer, int32_t buffer_size, int32_t timeout_ms) -> int32_t
+    {
+        return serialRead(handle, buffer, buffer_size, timeout_ms, 0, &recordLastError);
+    }
+
+    MODULE_API auto serialFastWrite(int32_t handle, const void *buffer, int32_t buffer_size, int32_t timeout_ms)
+        -> int32_t
+    {
+        return serialWrite(handle, buffer, buffer_size, timeout_ms, 0, &recordLastError);
+    }
+
+    MODULE_API auto serialFastLastError(char *message, int32_t message_size) -> int32_t
+    {
+        if (message != nullptr && message_size > 0)
+        {
+            const std::size_t length =
+                std::min(std::strlen(last_error.message.data()), static_cast<std::size_t>(message_size) - 1);
+            std::memcpy(message, last_error.message.data(), length);
+            message[length] = '\0';
+        }
+        return last_error.code;
+    }
+
+} // extern "C"
@@ -0,0 +1,71 @@
+#include <cpp_bindings_linux/interface/serial_fast.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/pty_pair.hpp"
+
+TEST(SerialFastTest, FailuresAreKeptAsLastError)
+{
+    std::array<char, 8> buffer{};
+    EXPECT_EQ(serialFastRead(-1, buffer.data(), static_cast<int32_t>(buffer.size()), 0),
+              static_cast<int32_t>(cpp_core::StatusCodes::kInvalidHandleError));
+
+    std::array<char, 64> message{};
+    EXPECT_EQ(serialFastLastError(message.data(), static_cast<int32_t>(message.size())),
+              static_cast<int32_t>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_STREQ(message.data(), "Invalid handle");
+
+    EXPECT_EQ(serialFastOpen("/dev/nonexistent_serial_port_12345", 9600, 8, 0, 1),
+              static_cast<int32_t>(cpp_core::StatusCodes::kNotFoundError));
+    EXPECT_EQ(serialFastLastError(nullptr, 0), static_cast<int32_t>(cpp_core::StatusCodes::kNotFoundError));
+}
+
+TEST(SerialFastTest, MessagesAreTruncatedToTheCallerBuffer)
+{
+    EXPECT_LT(serialFastWrite(-1, "x", 1, 0), 0);
+
+    std::array<char, 5> message{};
+    serialFastLastError(message.data(), static_cast<int32_t>(message.size()));
+    EXPECT_STREQ(message.data(), "Inva");
+}
+
+TEST(SerialFastTest, LastErrorIsPerThread)
+{
+    EXPECT_LT(serialFastClose(static_cast<int32_t>(0x7fffffff)), 0);
+    const int32_t here = serialFastLastError(nullptr, 0);
+    EXPECT_NE(here, 0);
+
+    int32_t other = -1;
+    std::thread([&other] { other = serialFastLastError(nullptr, 0); }).join();
+    EXPECT_EQ(other, 0);
+}
+
+TEST(SerialFastTest, RoundTripThroughPty)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    const int32_t handle = serialFastOpen(pty.slave_path.c_str(), 115200, 8, 0, 1);
+    ASSERT_GT(handle, 0);
+
+    EXPECT_EQ(serialFastWrite(handle, "fast", 4, 100), 4);
+    std::array<char, 8> echoed{};
+    ASSERT_EQ(read(pty.master_fd, echoed.data(), echoed.size()), 4);
+    EXPECT_EQ(std::string(echoed.data(), 4), "fast");
+
+    ASSERT_EQ(write(pty.master_fd, "path", 4), 4);
+    std::array<char, 8> buffer{};
+    EXPECT_EQ(serialFastRead(handle, buffer.data(), static_cast<int32_t>(buffer.size()), 1000), 4);
+    EXPECT_EQ(std::string(buffer.data(), 4), "path");
+
+    EXPECT_EQ(serialFastClose(handle), static_cast<int32_t>(cpp_core::StatusCodes::kSuccess));
+}
@@ -0,0 +1,69 @@
+#include <cpp_bindings_linux/interface/serial_low_latency.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+#include "detail/thread_tuning.hpp"
+
+#include <sched.h>
+#include <utility>
+#include <vector>
+
+extern "C"
+{
+    MODULE_API auto serialSetBusyPoll(int64_t handle, int64_t spin_budget_ns, ErrorCallbackT error_callback) -> int
+    {
+        if (spin_budget_ns < 0 || spin_budget_ns > kSerialBusyPollMaxNs)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid spin_budget_ns: must be 0 .. 1 s");
+        }
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+        state->read.busy_poll_ns.store(spin_budget_ns, std::memory_order_relaxed);
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialSetThreadTuning(const int *cpus, int cpu_count, int policy, int priority,
+                                          ErrorCallbackT error_callback) -> int
+    {
+        if (cpu_count < 0 || cpu_count > CPU_SETSIZE || (cpu_count > 0 && cpus == nullptr))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid cpus or cpu_count");
+        }
+        std::vector<int> cpu_list(cpus, cpus + cpu_count);
+        for (const int cpu : cpu_list)
+        {
+            if (cpu < 0 || cpu >= CPU_SETSIZE)
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid CPU number");
+            }
+        }
+
+        if (policy != SCHED_OTHER && policy != SCHED_BATCH && policy != SCHED_IDLE && policy != SCHED_FIFO &&
+            policy != SCHED_RR)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid policy");
+        }
+        if (priority < sched_get_priority_min(policy) || priority > sched_get_priority_max(policy))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid priority for policy");
+        }
+
+        const auto result =
+            cpp_bindings_linux::detail::ThreadTuning::instance().configure(std::move(cpu_list), policy, priority);
+        if (!result)
+        {
+            return cpp_bindings_linux::detail::failError<int>(error_callback, result.error());
+        }
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+} // extern "C"
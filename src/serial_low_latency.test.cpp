@@ -0,0 +1,118 @@
+#include <cpp_bindings_linux/interface/serial_low_latency.h>
+#include <cpp_bindings_linux/interface/serial_write_pacing.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <sched.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+class SerialLowLatencyTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        handle = pty.openSlave();
+        ASSERT_GT(handle, 0);
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+        // Back to the defaults, for the background threads of later tests.
+        serialSetThreadTuning(nullptr, 0, SCHED_OTHER, 0, nullptr);
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    PtyPair pty;
+    int64_t handle = 0;
+    std::array<char, 64> buffer{};
+};
+
+TEST_F(SerialLowLatencyTest, InvalidArguments)
+{
+    EXPECT_EQ(serialSetBusyPoll(-1, 1000, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialSetBusyPoll(handle, -1, error_callback), static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSetBusyPoll(handle, kSerialBusyPollMaxNs + 1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+
+    const std::array<int, 1> bad_cpu{-1};
+    EXPECT_EQ(serialSetThreadTuning(bad_cpu.data(), 1, SCHED_OTHER, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSetThreadTuning(nullptr, 1, SCHED_OTHER, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSetThreadTuning(nullptr, 0, 12345, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSetThreadTuning(nullptr, 0, SCHED_OTHER, 5, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialLowLatencyTest, BusyPollPicksUpDataWhileSpinning)
+{
+    ASSERT_EQ(serialSetBusyPoll(handle, 50'000'000, error_callback), 0);
+
+    std::jthread device([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        (void)write(pty.master_fd, "spin", 4);
+    });
+    const int bytes = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, error_callback);
+    ASSERT_EQ(bytes, 4);
+    EXPECT_EQ(std::string(buffer.data(), 4), "spin");
+}
+
+TEST_F(SerialLowLatencyTest, BusyPollFallsBackToTheBlockingWait)
+{
+    ASSERT_EQ(serialSetBusyPoll(handle, 1'000'000, error_callback), 0);
+
+    // 1 ms of spinning, then the wait covers the rest of the 30 ms timeout.
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 30, 0, error_callback), 0);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(30));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(200));
+
+    // A zero timeout never spins.
+    EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, error_callback), 0);
+    ASSERT_EQ(serialSetBusyPoll(handle, 0, error_callback), 0);
+}
+
+TEST_F(SerialLowLatencyTest, ThreadTuningAppliesToRunningBackgroundThreads)
+{
+    // Pacing starts the write pacer thread, which picks the settings up while it runs.
+    ASSERT_EQ(serialSetWritePacing(handle, 10, 1024, error_callback), 0);
+
+    cpu_set_t allowed;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+    int first_cpu = 0;
+    while (!CPU_ISSET(first_cpu, &allowed))
+    {
+        ++first_cpu;
+    }
+    const std::array<int, 1> cpus{first_cpu};
+    EXPECT_EQ(serialSetThreadTuning(cpus.data(), 1, SCHED_OTHER, 0, error_callback), 0);
+    EXPECT_EQ(serialSetThreadTuning(nullptr, 0, SCHED_BATCH, 0, error_callback), 0);
+
+    ASSERT_EQ(serialSetWritePacing(handle, 0, 0, error_callback), 0);
+}
@@ -1,40 +1,9 @@
 #include <cpp_core/interface/serial_open.h>
 #include <cpp_core/status_codes.h>
 
+#include "detail/open_port.hpp"
 #include "detail/posix_helpers.hpp"
 
-#include <fcntl.h>
-#include <sys/ioctl.h>
-#include <termios.h>
-#include <unistd.h>
-
-#ifndef TCGETS2
-#define TCGETS2 0x802C542A
-#define TCSETS2 0x402C542B
-#endif
-
-// Some libcs (or kernel headers) may not define BOTHER even if TCGETS2 exists.
-// Define it here if missing so the build works in minimal environments
-// (e.g., Deno's Debian-based CI containers).
-#ifndef BOTHER
-#define BOTHER 0x010000
-#endif
-
-// NOLINTBEGIN
-// C Structure is defined by the kernel, so we cannot change it.
-struct termios2
-{
-    tcflag_t c_iflag;
-    tcflag_t c_oflag;
-    tcflag_t c_cflag;
-    tcflag_t c_lflag;
-    cc_t c_line;
-    cc_t c_cc[19];
-    speed_t c_ispeed;
-    speed_t c_ospeed;
-};
-// NOLINTEND
-
 extern "C"
 {
     MODULE_API auto serialOpen(void *port, int baudrate, int data_bits, int parity, int stop_bits,
@@ -46,119 +15,14 @@ extern "C"
                                                                  "Port parameter is nullptr");
         }
 
-        if (baudrate < 300)
-        {
-            return cpp_bindings_linux::detail::failMsg<intptr_t>(error_callback, cpp_core::StatusCodes::kSetStateError,
-                                                                 "Invalid baudrate: must be >= 300");
-        }
-
-        if (data_bits < 5 || data_bits > 8)
-        {
-            return cpp_bindings_linux::detail::failMsg<intptr_t>(error_callback, cpp_core::StatusCodes::kSetStateError,
-                                                                 "Invalid data bits: must be 5-8");
-        }
-
-        const char *port_path = static_cast<const char *>(port);
-
-        cpp_bindings_linux::detail::UniqueFd handle(open(port_path, O_RDWR | O_NOCTTY | O_NONBLOCK));
-        if (!handle.valid())
-        {
-            return cpp_bindings_linux::detail::failErrno<intptr_t>(error_callback,
-                                                                   cpp_core::StatusCodes::kNotFoundError);
-        }
-
-        struct termios2 tty = {};
-        if (ioctl(handle.get(), TCGETS2, &tty) != 0)
-        {
-            return cpp_bindings_linux::detail::failErrno<intptr_t>(error_callback,
-                                                                   cpp_core::StatusCodes::kGetStateError);
-        }
-
-        tty.c_cflag &= ~CBAUD;
-        tty.c_cflag |= BOTHER;
-        tty.c_ispeed = baudrate;
-        tty.c_ospeed = baudrate;
-
-        tty.c_cflag &= ~CSIZE;
-        switch (data_bits)
+        const auto opened = cpp_bindings_linux::detail::openRegisteredPort(static_cast<const char *>(port), baudrate,
+                                                                           data_bits, parity, stop_bits);
+        if (!opened)
         {
-        case 5:
-            tty.c_cflag |= CS5;
-            break;
-        case 6:
-            tty.c_cflag |= CS6;
-            break;
-        case 7:
-            tty.c_cflag |= CS7;
-            break;
-        case 8:
-            tty.c_cflag |= CS8;
-            break;
-        default:
-            return cpp_bindings_linux::detail::failMsg<intptr_t>(error_callback, cpp_core::StatusCodes::kSetStateError,
-                                                                 "Invalid data bits");
+            return cpp_bindings_linux::detail::failError<intptr_t>(error_callback, opened.error());
         }
 
-        tty.c_cflag &= ~(PARENB | PARODD);
-        switch (parity)
-        {
-        // parity mapping:
-        //   0 = no parity
-        //   1 = even parity
-        //   2 = odd parity
-        case 0:
-            break;
-        case 1:
-            tty.c_cflag |= PARENB;
-            break;
-        case 2:
-            tty.c_cflag |= (PARENB | PARODD);
-            break;
-        default:
-            return cpp_bindings_linux::detail::failMsg<intptr_t>(error_callback, cpp_core::StatusCodes::kSetStateError,
-                                                                 "Invalid parity");
-        }
-
-        // stop_bits mapping:
-        //   0 or 1 = 1 stop bit (0 kept for backward compatibility with callers using "default")
-        //   2      = 2 stop bits
-        if (stop_bits != 0 && stop_bits != 1 && stop_bits != 2)
-        {
-            return cpp_bindings_linux::detail::failMsg<intptr_t>(error_callback, cpp_core::StatusCodes::kSetStateError,
-                                                                 "Invalid stop bits: must be 0, 1, or 2");
-        }
-        if (stop_bits == 2)
-        {
-            tty.c_cflag |= CSTOPB;
-        }
-        else
-        {
-            tty.c_cflag &= ~CSTOPB;
-        }
-
-        tty.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG);
-        tty.c_iflag &= ~(IXON | IXOFF | IXANY | INLCR | IGNCR | ICRNL);
-        tty.c_oflag &= ~OPOST;
-
-        tty.c_cc[VMIN] = 0;
-        tty.c_cc[VTIME] = 0;
-
-        if (ioctl(handle.get(), TCSETS2, &tty) != 0)
-        {
-            return cpp_bindings_linux::detail::failErrno<intptr_t>(error_callback,
-                                                                   cpp_core::StatusCodes::kSetStateError);
-        }
-
-        // Keep O_NONBLOCK enabled. Our read/write APIs implement timeouts via poll(),
-        // and leaving the FD non-blocking prevents any unexpected blocking syscalls.
-
-        tcflush(handle.get(), TCIOFLUSH);
-
-        // Note: Some devices (e.g., Arduino) reset when the serial port is opened.
-        // It is recommended to wait 1-2 seconds after opening before sending data
-        // to allow the device to initialize.
-
-        return static_cast<intptr_t>(handle.release());
+        return static_cast<intptr_t>(*opened);
     }
 
 } // extern "C"
@@ -0,0 +1,98 @@
+#include <cpp_bindings_linux/interface/serial_open_batch.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/open_port.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr int kDefaultThreads = 16;
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialOpenBatch(const SerialOpenRequest *requests, int64_t *handles, int count, int max_threads,
+                                    ErrorCallbackT error_callback) -> int
+    {
+        if (count < 0 || (count > 0 && (requests == nullptr || handles == nullptr)))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid requests, handles or count");
+        }
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        // Failures are collected and reported afterwards, so the callback only ever runs on the caller's thread.
+        std::vector<cpp_bindings_linux::SerialError> errors(static_cast<std::size_t>(count));
+        std::atomic<int> next{0};
+
+        const auto work = [&] {
+            for (int i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+                 i = next.fetch_add(1, std::memory_order_relaxed))
+            {
+                const SerialOpenRequest &request = requests[i];
+                if (request.port == nullptr)
+                {
+                    errors[static_cast<std::size_t>(i)] = {cpp_core::StatusCodes::kNotFoundError, 0,
+                                                           "Port parameter is nullptr"};
+                    handles[i] = static_cast<int64_t>(cpp_core::StatusCodes::kNotFoundError);
+                    continue;
+                }
+
+                const auto opened = cpp_bindings_linux::detail::openRegisteredPort(
+                    request.port, request.baudrate, request.data_bits, request.parity, request.stop_bits);
+                if (opened)
+                {
+                    handles[i] = *opened;
+                }
+                else
+                {
+                    errors[static_cast<std::size_t>(i)] = opened.error();
+                    handles[i] = static_cast<int64_t>(opened.error().code);
+                }
+            }
+        };
+
+        const int threads =
+            std::min({count, max_threads <= 0 ? kDefaultThreads : max_threads, kSerialOpenBatchMaxThreads});
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(static_cast<std::size_t>(threads - 1));
+            for (int t = 1; t < threads; ++t)
+            {
+                try
+                {
+                    workers.emplace_back(work);
+                }
+                catch (const std::system_error &)
+                {
+                    break; // out of threads: the ones already running (and the caller) take the rest
+                }
+            }
+            work();
+        }
+
+        int opened_count = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            if (handles[i] > 0)
+            {
+                ++opened_count;
+            }
+            else
+            {
+                cpp_bindings_linux::detail::failError<int>(error_callback, errors[static_cast<std::size_t>(i)]);
+            }
+        }
+        return opened_count;
+    }
+
+} // extern "C"
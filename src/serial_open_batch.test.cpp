@@ -0,0 +1,91 @@
+#include <cpp_bindings_linux/interface/serial_open_batch.h>
+#include <cpp_bindings_linux/interface/serial_stats.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+class SerialOpenBatchTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+    }
+
+    void TearDown() override
+    {
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+};
+
+TEST_F(SerialOpenBatchTest, InvalidArguments)
+{
+    std::array<int64_t, 1> handles{};
+    EXPECT_EQ(serialOpenBatch(nullptr, handles.data(), 1, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialOpenBatch(nullptr, nullptr, -1, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialOpenBatchTest, EmptyBatch)
+{
+    EXPECT_EQ(serialOpenBatch(nullptr, nullptr, 0, 0, error_callback), 0);
+}
+
+TEST_F(SerialOpenBatchTest, OpensEveryPortAndReportsFailuresPerEntry)
+{
+    constexpr int kPorts = 12;
+    std::vector<std::unique_ptr<PtyPair>> ptys;
+    std::vector<SerialOpenRequest> requests;
+    for (int i = 0; i < kPorts; ++i)
+    {
+        ptys.push_back(std::make_unique<PtyPair>());
+        if (!ptys.back()->valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        requests.push_back({ptys.back()->slave_path.c_str(), 115200, 8, 0, 1});
+    }
+    requests.push_back({"/dev/nonexistent_serial_port_12345", 9600, 8, 0, 1});
+    requests.push_back({nullptr, 9600, 8, 0, 1});
+    requests.push_back({ptys.front()->slave_path.c_str(), 9600, 8, 7, 1}); // invalid parity
+
+    std::vector<int64_t> handles(requests.size(), 0);
+    const int opened =
+        serialOpenBatch(requests.data(), handles.data(), static_cast<int>(requests.size()), 4, error_callback);
+
+    EXPECT_EQ(opened, kPorts);
+    for (int i = 0; i < kPorts; ++i)
+    {
+        ASSERT_GT(handles[static_cast<std::size_t>(i)], 0) << "port " << i;
+        SerialPortStats stats{};
+        EXPECT_EQ(serialGetStats(handles[static_cast<std::size_t>(i)], &stats, nullptr),
+                  static_cast<int>(cpp_core::StatusCodes::kSuccess));
+    }
+    EXPECT_EQ(handles[kPorts], static_cast<int64_t>(cpp_core::StatusCodes::kNotFoundError));
+    EXPECT_EQ(handles[kPorts + 1], static_cast<int64_t>(cpp_core::StatusCodes::kNotFoundError));
+    EXPECT_EQ(handles[kPorts + 2], static_cast<int64_t>(cpp_core::StatusCodes::kSetStateError));
+
+    // One callback per failed entry, delivered in request order on this thread.
+    EXPECT_EQ(error_capture.call_count, 3);
+    EXPECT_EQ(error_capture.last_code, static_cast<int>(cpp_core::StatusCodes::kSetStateError));
+    EXPECT_EQ(error_capture.last_message, "Invalid parity");
+
+    for (int i = 0; i < kPorts; ++i)
+    {
+        EXPECT_EQ(serialClose(handles[static_cast<std::size_t>(i)], nullptr),
+                  static_cast<int>(cpp_core::StatusCodes::kSuccess));
+    }
+}
@@ -0,0 +1,224 @@
+#include <cpp_bindings_linux/serial_port.hpp>
+#include <cpp_core/status_codes.h>
+
+#include "detail/posix_helpers.hpp"
+#include "detail/read_loop.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <fcntl.h>
+#include <limits>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#ifndef TCGETS2
+#define TCGETS2 0x802C542A
+#define TCSETS2 0x402C542B
+#endif
+
+// Some libcs (or kernel headers) may not define BOTHER even if TCGETS2 exists.
+// Define it here if missing so the build works in minimal environments
+// (e.g., Deno's Debian-based CI containers).
+#ifndef BOTHER
+#define BOTHER 0x010000
+#endif
+
+// NOLINTBEGIN
+// C Structure is defined by the kernel, so we cannot change it.
+struct termios2
+{
+    tcflag_t c_iflag;
+    tcflag_t c_oflag;
+    tcflag_t c_cflag;
+    tcflag_t c_lflag;
+    cc_t c_line;
+    cc_t c_cc[19];
+    speed_t c_ispeed;
+    speed_t c_ospeed;
+};
+// NOLINTEND
+
+namespace cpp_bindings_linux
+{
+namespace
+{
+auto failure(cpp_core::StatusCodes code, const char *message) -> std::unexpected<SerialError>
+{
+    return std::unexpected(SerialError{code, 0, message});
+}
+
+auto osFailure(cpp_core::StatusCodes code) -> std::unexpected<SerialError>
+{
+    return std::unexpected(SerialError{code, errno, nullptr});
+}
+
+auto clampSize(std::size_t size) -> int
+{
+    return static_cast<int>(std::min<std::size_t>(size, std::numeric_limits<int>::max()));
+}
+} // namespace
+
+auto SerialPort::open(const std::string &path, const SerialOptions &options) -> SerialResult<SerialPort>
+{
+    if (options.baudrate < 300)
+    {
+        return failure(cpp_core::StatusCodes::kSetStateError, "Invalid baudrate: must be >= 300");
+    }
+
+    if (options.data_bits < 5 || options.data_bits > 8)
+    {
+        return failure(cpp_core::StatusCodes::kSetStateError, "Invalid data bits: must be 5-8");
+    }
+
+    if (options.parity != Parity::kNone && options.parity != Parity::kEven && options.parity != Parity::kOdd)
+    {
+        return failure(cpp_core::StatusCodes::kSetStateError, "Invalid parity");
+    }
+
+    // stop_bits mapping:
+    //   0 or 1 = 1 stop bit (0 kept for backward compatibility with callers using "default")
+    //   2      = 2 stop bits
+    if (options.stop_bits != 0 && options.stop_bits != 1 && options.stop_bits != 2)
+    {
+        return failure(cpp_core::StatusCodes::kSetStateError, "Invalid stop bits: must be 0, 1, or 2");
+    }
+
+    detail::UniqueFd handle(::open(path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK));
+    if (!handle.valid())
+    {
+        return osFailure(cpp_core::StatusCodes::kNotFoundError);
+    }
+
+    struct termios2 tty = {};
+    if (ioctl(handle.get(), TCGETS2, &tty) != 0)
+    {
+        return osFailure(cpp_core::StatusCodes::kGetStateError);
+    }
+
+    tty.c_cflag &= ~CBAUD;
+    tty.c_cflag |= BOTHER;
+    tty.c_ispeed = options.baudrate;
+    tty.c_ospeed = options.baudrate;
+
+    static constexpr std::array<tcflag_t, 4> kCharacterSize = {CS5, CS6, CS7, CS8};
+    tty.c_cflag &= ~CSIZE;
+    tty.c_cflag |= kCharacterSize[static_cast<std::size_t>(options.data_bits - 5)];
+
+    tty.c_cflag &= ~(PARENB | PARODD);
+    switch (options.parity)
+    {
+    case Parity::kNone:
+        break;
+    case Parity::kEven:
+        tty.c_cflag |= PARENB;
+        break;
+    case Parity::kOdd:
+        tty.c_cflag |= (PARENB | PARODD);
+        break;
+    }
+
+    if (options.stop_bits == 2)
+    {
+        tty.c_cflag |= CSTOPB;
+    }
+    else
+    {
+        tty.c_cflag &= ~CSTOPB;
+    }
+
+    tty.c_lflag &= ~(ICANON | ECHO | ECHOE | ISIG);
+    tty.c_iflag &= ~(IXON | IXOFF | IXANY | INLCR | IGNCR | ICRNL);
+    tty.c_oflag &= ~OPOST;
+
+    tty.c_cc[VMIN] = 0;
+    tty.c_cc[VTIME] = 0;
+
+    if (ioctl(handle.get(), TCSETS2, &tty) != 0)
+    {
+        return osFailure(cpp_core::StatusCodes::kSetStateError);
+    }
+
+    // Keep O_NONBLOCK enabled. Our read/write APIs implement timeouts via poll(),
+    // and leaving the FD non-blocking prevents any unexpected blocking syscalls.
+
+    tcflush(handle.get(), TCIOFLUSH);
+
+    // Note: Some devices (e.g., Arduino) reset when the serial port is opened.
+    // It is recommended to wait 1-2 seconds after opening before sending data
+    // to allow the device to initialize.
+
+    return SerialPort(std::move(handle));
+}
+
+auto SerialPort::close() -> SerialResult<void>
+{
+    if (!fd_.valid())
+    {
+        return {};
+    }
+    if (::close(fd_.release()) != 0)
+    {
+        return osFailure(cpp_core::StatusCodes::kCloseHandleError);
+    }
+    return {};
+}
+
+auto SerialPortView::read(std::span<std::byte> buffer, std::chrono::nanoseconds timeout) const
+    -> SerialResult<std::size_t>
+{
+    if (buffer.empty())
+    {
+        return failure(cpp_core::StatusCodes::kBufferError, "Invalid buffer or buffer_size");
+    }
+
+    detail::NoReadObserver observer;
+    const ssize_t total_read =
+        detail::readWithTimeoutNs(fd_, reinterpret_cast<unsigned char *>(buffer.data()), clampSize(buffer.size()),
+                                  detail::toTimeoutNs(timeout), observer);
+    if (total_read < 0)
+    {
+        return osFailure(cpp_core::StatusCodes::kReadError);
+    }
+    return static_cast<std::size_t>(total_read);
+}
+
+auto SerialPortView::write(std::span<const std::byte> data, std::chrono::nanoseconds timeout) const
+    -> SerialResult<std::size_t>
+{
+    if (data.empty())
+    {
+        return failure(cpp_core::StatusCodes::kBufferError, "Invalid buffer or buffer_size");
+    }
+
+    const auto size = static_cast<size_t>(clampSize(data.size()));
+    ssize_t bytes_written = ::write(fd_, data.data(), size);
+    if (bytes_written < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            const int ready = detail::waitFdReadyNs(fd_, detail::toTimeoutNs(timeout), false);
+            if (ready < 0)
+            {
+                return osFailure(cpp_core::StatusCodes::kWriteError);
+            }
+            if (ready == 0)
+            {
+                return 0;
+            }
+            bytes_written = ::write(fd_, data.data(), size);
+        }
+
+        if (bytes_written < 0)
+        {
+            return osFailure(cpp_core::StatusCodes::kWriteError);
+        }
+    }
+
+    tcdrain(fd_);
+
+    return static_cast<std::size_t>(bytes_written);
+}
+
+} // namespace cpp_bindings_linux
@@ -0,0 +1,115 @@
+#include <cpp_bindings_linux/serial_port.hpp>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/pty_pair.hpp"
+
+using cpp_bindings_linux::Parity;
+using cpp_bindings_linux::SerialOptions;
+using cpp_bindings_linux::SerialPort;
+
+class SerialPortTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+    }
+
+    PtyPair pty;
+};
+
+TEST(SerialPortOpenTest, InvalidOptionsAreRejectedBeforeOpening)
+{
+    const auto bad_baud = SerialPort::open("/dev/null", SerialOptions{.baudrate = 100});
+    ASSERT_FALSE(bad_baud);
+    EXPECT_EQ(bad_baud.error().code, cpp_core::StatusCodes::kSetStateError);
+    EXPECT_EQ(bad_baud.error().what(), "Invalid baudrate: must be >= 300");
+
+    const auto bad_parity = SerialPort::open("/dev/null", SerialOptions{.parity = static_cast<Parity>(5)});
+    ASSERT_FALSE(bad_parity);
+    EXPECT_EQ(bad_parity.error().code, cpp_core::StatusCodes::kSetStateError);
+}
+
+TEST(SerialPortOpenTest, MissingDeviceReportsErrno)
+{
+    const auto result = SerialPort::open("/dev/nonexistent_serial_port_12345", SerialOptions{});
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code, cpp_core::StatusCodes::kNotFoundError);
+    EXPECT_EQ(result.error().error_number, ENOENT);
+    EXPECT_EQ(result.error().message, nullptr);
+    EXPECT_FALSE(result.error().what().empty());
+}
+
+TEST_F(SerialPortTest, RoundTripThroughPty)
+{
+    auto port = SerialPort::open(pty.slave_path, SerialOptions{.baudrate = 115200});
+    ASSERT_TRUE(port) << port.error().what();
+    ASSERT_TRUE(port->valid());
+
+    const std::array<std::byte, 4> outgoing = {std::byte{'p'}, std::byte{'i'}, std::byte{'n'}, std::byte{'g'}};
+    const auto written = port->write(outgoing, std::chrono::milliseconds(100));
+    ASSERT_TRUE(written);
+    EXPECT_EQ(*written, outgoing.size());
+
+    std::array<char, 8> echoed{};
+    ASSERT_EQ(read(pty.master_fd, echoed.data(), echoed.size()), 4);
+    EXPECT_EQ(std::memcmp(echoed.data(), "ping", 4), 0);
+
+    ASSERT_EQ(write(pty.master_fd, "pong", 4), 4);
+    std::array<std::byte, 8> incoming{};
+    const auto received = port->read(incoming, std::chrono::milliseconds(1000));
+    ASSERT_TRUE(received);
+    ASSERT_EQ(*received, 4U);
+    EXPECT_EQ(std::memcmp(incoming.data(), "pong", 4), 0);
+}
+
+TEST_F(SerialPortTest, ReadTimesOutWithZeroBytes)
+{
+    auto port = SerialPort::open(pty.slave_path, SerialOptions{});
+    ASSERT_TRUE(port);
+
+    std::array<std::byte, 8> incoming{};
+    const auto received = port->read(incoming, std::chrono::milliseconds(10));
+    ASSERT_TRUE(received);
+    EXPECT_EQ(*received, 0U);
+}
+
+TEST_F(SerialPortTest, EmptyBufferIsAnError)
+{
+    auto port = SerialPort::open(pty.slave_path, SerialOptions{});
+    ASSERT_TRUE(port);
+
+    const auto received = port->read({}, std::chrono::milliseconds(0));
+    ASSERT_FALSE(received);
+    EXPECT_EQ(received.error().code, cpp_core::StatusCodes::kBufferError);
+}
+
+TEST_F(SerialPortTest, OwnershipFollowsMoves)
+{
+    auto port = SerialPort::open(pty.slave_path, SerialOptions{});
+    ASSERT_TRUE(port);
+    const int fd = port->nativeHandle();
+
+    SerialPort moved = std::move(*port);
+    EXPECT_FALSE(port->valid()); // NOLINT(bugprone-use-after-move)
+    EXPECT_EQ(moved.nativeHandle(), fd);
+
+    EXPECT_TRUE(moved.close());
+    EXPECT_FALSE(moved.valid());
+    EXPECT_EQ(fcntl(fd, F_GETFD), -1);
+
+    // Closing twice is harmless.
+    EXPECT_TRUE(moved.close());
+}
@@ -0,0 +1,110 @@
+#include <cpp_bindings_linux/interface/serial_queue_depth.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <limits>
+#include <sys/ioctl.h>
+
+namespace
+{
+auto queueDepth(int64_t handle, unsigned long request, ErrorCallbackT error_callback) -> int
+{
+    if (handle <= 0 || handle > std::numeric_limits<int>::max())
+    {
+        return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                        "Invalid handle");
+    }
+
+    int queued = 0;
+    if (ioctl(static_cast<int>(handle), request, &queued) != 0)
+    {
+        return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kGetStateError);
+    }
+    return queued;
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialInputQueueDepth(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return queueDepth(handle, TIOCINQ, error_callback);
+    }
+
+    MODULE_API auto serialOutputQueueDepth(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return queueDepth(handle, TIOCOUTQ, error_callback);
+    }
+
+    MODULE_API auto serialSetOutputLowWater(int64_t handle, int low_water, ErrorCallbackT error_callback) -> int
+    {
+        if (low_water < 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid low_water: must be >= 0");
+        }
+
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        state->write.output_low_water.store(low_water, std::memory_order_relaxed);
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialWaitOutputLowWater(int64_t handle, int timeout_ms, ErrorCallbackT error_callback) -> int
+    {
+        const auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        if (timeout_ms < 0)
+        {
+            timeout_ms = 0;
+        }
+        const int fd = static_cast<int>(handle);
+
+        const int low_water = state->write.output_low_water.load(std::memory_order_relaxed);
+        const int64_t ns_per_byte = state->config.nsPerByte();
+        const cpp_bindings_linux::detail::Deadline deadline(timeout_ms);
+
+        while (true)
+        {
+            int queued = 0;
+            if (ioctl(fd, TIOCOUTQ, &queued) != 0)
+            {
+                return cpp_bindings_linux::detail::failErrno<int>(error_callback,
+                                                                  cpp_core::StatusCodes::kGetStateError);
+            }
+            if (queued <= low_water)
+            {
+                return 1;
+            }
+
+            const int remaining_ms = deadline.remainingMs();
+            if (remaining_ms == 0)
+            {
+                return 0;
+            }
+
+            // The kernel has no "below N bytes" wakeup, so sleep for the wire time of the excess and check again.
+            // At least 1 ms, so flow-controlled (stalled) ports do not turn this into a spin.
+            const int64_t drain_ns = std::max<int64_t>(static_cast<int64_t>(queued - low_water) * ns_per_byte,
+                                                       1'000'000);
+            const int64_t sleep_ns = std::min<int64_t>(drain_ns, static_cast<int64_t>(remaining_ms) * 1'000'000);
+            const struct timespec sleep_time = {static_cast<time_t>(sleep_ns / 1'000'000'000),
+                                                static_cast<long>(sleep_ns % 1'000'000'000)};
+            clock_nanosleep(CLOCK_MONOTONIC, 0, &sleep_time, nullptr);
+        }
+    }
+
+} // extern "C"
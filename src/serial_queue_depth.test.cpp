@@ -0,0 +1,98 @@
+#include <cpp_bindings_linux/interface/serial_queue_depth.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+class SerialQueueDepthTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        handle = pty.openSlave();
+        ASSERT_GT(handle, 0);
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    PtyPair pty;
+    int64_t handle = 0;
+};
+
+TEST_F(SerialQueueDepthTest, InvalidHandle)
+{
+    EXPECT_EQ(serialInputQueueDepth(-1, error_callback), static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialOutputQueueDepth(0, error_callback), static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialSetOutputLowWater(-1, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialWaitOutputLowWater(-1, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
+
+TEST_F(SerialQueueDepthTest, NotATerminal)
+{
+    std::array<int, 2> pipefd{};
+    ASSERT_EQ(pipe(pipefd.data()), 0);
+
+    EXPECT_EQ(serialOutputQueueDepth(pipefd[1], error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kGetStateError));
+    EXPECT_EQ(serialSetOutputLowWater(pipefd[1], 16, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+
+    close(pipefd[0]);
+    close(pipefd[1]);
+}
+
+TEST_F(SerialQueueDepthTest, InputQueueReportsPendingBytes)
+{
+    EXPECT_EQ(serialInputQueueDepth(handle, error_callback), 0);
+
+    ASSERT_EQ(write(pty.master_fd, "pending", 7), 7);
+    ASSERT_TRUE(PtyPair::waitQueued(handle, 7));
+
+    EXPECT_EQ(serialInputQueueDepth(handle, error_callback), 7);
+}
+
+TEST_F(SerialQueueDepthTest, OutputQueueOnPtyIsImmediatelyDrained)
+{
+    ASSERT_EQ(serialWrite(handle, "abc", 3, 100, 0, error_callback), 3);
+
+    // A pty hands written bytes straight to the other side, so nothing stays queued for transmission.
+    EXPECT_EQ(serialOutputQueueDepth(handle, error_callback), 0);
+}
+
+TEST_F(SerialQueueDepthTest, NegativeLowWaterRejected)
+{
+    EXPECT_EQ(serialSetOutputLowWater(handle, -1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialQueueDepthTest, WaitReturnsOnceBelowLowWater)
+{
+    ASSERT_EQ(serialSetOutputLowWater(handle, 64, error_callback), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+
+    EXPECT_EQ(serialWaitOutputLowWater(handle, 100, error_callback), 1);
+}
@@ -1,102 +1,107 @@
+#include <cpp_bindings_linux/interface/serial_timeout_ns.h>
+#include <cpp_bindings_linux/serial_port.hpp>
 #include <cpp_core/interface/serial_read.h>
 #include <cpp_core/status_codes.h>
 
+#include "detail/link_compression.hpp"
+#include "detail/port_registry.hpp"
 #include "detail/posix_helpers.hpp"
+#include "detail/read_loop.hpp"
 
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
+#include <cstddef>
 #include <limits>
-#include <unistd.h>
 
-extern "C"
+namespace
 {
-    MODULE_API auto serialRead(int64_t handle, void *buffer, int buffer_size, int timeout_ms, int /*multiplier*/,
-                               ErrorCallbackT error_callback) -> int
+// Uncompressed read, with the busy-poll phase in front of the blocking wait when the handle has one.
+auto readDirect(int fd, const cpp_bindings_linux::detail::PortState *state, unsigned char *buffer, int buffer_size,
+                std::chrono::nanoseconds timeout) -> cpp_bindings_linux::SerialResult<std::size_t>
+{
+    const int64_t spin_ns = state != nullptr ? state->read.busy_poll_ns.load(std::memory_order_relaxed) : 0;
+    const int64_t timeout_ns = cpp_bindings_linux::detail::toTimeoutNs(timeout);
+    if (spin_ns > 0 && timeout_ns > 0)
     {
-        if (buffer == nullptr || buffer_size <= 0)
+        const auto deadline = cpp_bindings_linux::detail::Deadline::afterNs(timeout_ns);
+        const ssize_t bytes =
+            cpp_bindings_linux::detail::spinRead(fd, buffer, buffer_size, std::min(spin_ns, timeout_ns));
+        if (bytes < 0)
         {
-            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
-                                                            "Invalid buffer or buffer_size");
+            return std::unexpected(cpp_bindings_linux::SerialError{cpp_core::StatusCodes::kReadError, errno, nullptr});
         }
-
-        if (handle <= 0 || handle > std::numeric_limits<int>::max())
+        if (bytes > 0)
         {
-            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
-                                                            "Invalid handle");
+            return static_cast<std::size_t>(bytes);
         }
+        timeout = std::chrono::nanoseconds(deadline.remainingNs());
+    }
+    return cpp_bindings_linux::SerialPortView(fd).read(
+        {reinterpret_cast<std::byte *>(buffer), static_cast<std::size_t>(buffer_size)}, timeout);
+}
 
-        if (timeout_ms < 0)
-        {
-            timeout_ms = 0;
-        }
+// serialRead() and serialReadNs() differ only in the unit of their timeout.
+auto readPort(int64_t handle, void *buffer, int buffer_size, std::chrono::nanoseconds timeout,
+              ErrorCallbackT error_callback) -> int
+{
+    if (buffer == nullptr || buffer_size <= 0)
+    {
+        return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                        "Invalid buffer or buffer_size");
+    }
 
-        const int fd = static_cast<int>(handle);
-        auto *buf = static_cast<unsigned char *>(buffer);
+    if (handle <= 0 || handle > std::numeric_limits<int>::max())
+    {
+        return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                        "Invalid handle");
+    }
 
-        const int ready = cpp_bindings_linux::detail::waitFdReady(fd, timeout_ms, true);
-        if (ready < 0)
-        {
-            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
-        }
-        if (ready == 0)
-        {
-            return 0;
-        }
+    const int fd = static_cast<int>(handle);
 
-        const auto try_read_once = [&](unsigned char *dst, int size) -> ssize_t {
-            const ssize_t bytes = ::read(fd, dst, size);
-            if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
-            {
-                return 0;
-            }
-            return bytes;
-        };
+    auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+    const auto side_lock = cpp_bindings_linux::detail::lockReadSide(state);
+    if (cpp_bindings_linux::detail::rejectFanoutRead(state, error_callback))
+    {
+        return static_cast<int>(cpp_core::StatusCodes::kReadError);
+    }
 
-        ssize_t bytes_read = try_read_once(buf, buffer_size);
-        if (bytes_read < 0)
-        {
-            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
-        }
+    // Bytes a transaction kept (see serialTransact()) are already received; they are returned without a read().
+    const int carried = cpp_bindings_linux::detail::takeCarried(state, buffer, buffer_size);
+    if (carried > 0)
+    {
+        cpp_bindings_linux::detail::recordRead(state, carried);
+        return carried;
+    }
 
-        // Some drivers can report readiness but still return 0; give it a tiny grace period and retry once.
-        if (bytes_read == 0)
-        {
-            const int retry_ready = cpp_bindings_linux::detail::waitFdReady(fd, 10, true);
-            if (retry_ready < 0)
-            {
-                return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
-            }
-            if (retry_ready == 0)
-            {
-                return 0;
-            }
-            bytes_read = try_read_once(buf, buffer_size);
-            if (bytes_read <= 0)
-            {
-                return 0;
-            }
-        }
+    const auto result =
+        state != nullptr && state->read.compression != nullptr
+            ? cpp_bindings_linux::detail::compressedRead(fd, *state->read.compression,
+                                                         static_cast<unsigned char *>(buffer), buffer_size,
+                                                         cpp_bindings_linux::detail::toTimeoutNs(timeout))
+            : readDirect(fd, state, static_cast<unsigned char *>(buffer), buffer_size, timeout);
+    if (!result)
+    {
+        return cpp_bindings_linux::detail::failError<int>(error_callback, result.error());
+    }
+    cpp_bindings_linux::detail::recordRead(state, static_cast<int64_t>(*result));
 
-        int total_read = static_cast<int>(bytes_read);
-        while (total_read < buffer_size)
-        {
-            const int loop_ready = cpp_bindings_linux::detail::waitFdReady(fd, 0, true);
-            if (loop_ready < 0)
-            {
-                return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
-            }
-            if (loop_ready == 0)
-            {
-                break;
-            }
-            const ssize_t more_bytes = try_read_once(buf + total_read, buffer_size - total_read);
-            if (more_bytes <= 0)
-            {
-                break;
-            }
-            total_read += static_cast<int>(more_bytes);
-        }
+    return static_cast<int>(*result);
+}
+} // namespace
 
-        return total_read;
+extern "C"
+{
+    MODULE_API auto serialRead(int64_t handle, void *buffer, int buffer_size, int timeout_ms, int /*multiplier*/,
+                               ErrorCallbackT error_callback) -> int
+    {
+        return readPort(handle, buffer, buffer_size, std::chrono::milliseconds(timeout_ms), error_callback);
+    }
+
+    MODULE_API auto serialReadNs(int64_t handle, void *buffer, int buffer_size, int64_t timeout_ns,
+                                 ErrorCallbackT error_callback) -> int
+    {
+        return readPort(handle, buffer, buffer_size, std::chrono::nanoseconds(timeout_ns), error_callback);
     }
 
 } // extern "C"
@@ -1,14 +1,20 @@
+#include <cpp_bindings_linux/interface/serial_timeout_ns.h>
+#include <cpp_core/interface/serial_close.h>
 #include <cpp_core/interface/serial_read.h>
 #include <cpp_core/status_codes.h>
 
 #include <array>
+#include <chrono>
 #include <fcntl.h>
 #include <limits>
+#include <string>
 #include <unistd.h>
 
 #include <gtest/gtest.h>
 
 #include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+#include "test_helpers/syscall_counter.hpp"
 
 class SerialReadTest : public ::testing::Test
 {
@@ -125,3 +131,133 @@ TEST_F(SerialReadTest, ReadWithVariousTimeouts)
 
     close(fd);
 }
+
+class SerialReadPtyTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        handle = pty.openSlave();
+        ASSERT_GT(handle, 0);
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+    }
+
+    auto sendFromDevice(const std::string &data) const -> void
+    {
+        ASSERT_EQ(write(pty.master_fd, data.data(), data.size()), static_cast<ssize_t>(data.size()));
+        ASSERT_TRUE(PtyPair::waitQueued(handle, static_cast<int>(data.size())));
+    }
+
+    PtyPair pty;
+    int64_t handle = 0;
+    std::array<char, 64> buffer{};
+};
+
+TEST_F(SerialReadPtyTest, ReadsQueuedData)
+{
+    sendFromDevice("hello pty");
+
+    int result = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, nullptr);
+
+    ASSERT_EQ(result, 9);
+    EXPECT_EQ(std::string(buffer.data(), 9), "hello pty");
+}
+
+TEST_F(SerialReadPtyTest, ReadRespectsBufferSize)
+{
+    sendFromDevice("0123456789");
+
+    EXPECT_EQ(serialRead(handle, buffer.data(), 4, 0, 0, nullptr), 4);
+    EXPECT_EQ(std::string(buffer.data(), 4), "0123");
+    EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, nullptr), 6);
+    EXPECT_EQ(std::string(buffer.data(), 6), "456789");
+}
+
+// Syscall budgets: these lock in the single-wait, single-read path so it cannot quietly regress.
+
+TEST_F(SerialReadPtyTest, SyscallsWithTimeoutAndData)
+{
+    sendFromDevice("data");
+
+    SyscallCounter counter;
+    int result = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, nullptr);
+
+    EXPECT_EQ(result, 4);
+    EXPECT_EQ(counter.counts().poll, 1);
+    EXPECT_EQ(counter.counts().read, 1);
+    EXPECT_EQ(counter.counts().total(), 2);
+}
+
+TEST_F(SerialReadPtyTest, SyscallsWithTimeoutAndNoData)
+{
+    SyscallCounter counter;
+    int result = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 10, 0, nullptr);
+
+    EXPECT_EQ(result, 0);
+    EXPECT_EQ(counter.counts().poll, 1);
+    EXPECT_EQ(counter.counts().total(), 1);
+}
+
+TEST_F(SerialReadPtyTest, SyscallsNonBlockingIdle)
+{
+    SyscallCounter counter;
+    int result = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, nullptr);
+
+    EXPECT_EQ(result, 0);
+    EXPECT_EQ(counter.counts().ioctl, 1);
+    EXPECT_EQ(counter.counts().total(), 1);
+}
+
+TEST_F(SerialReadPtyTest, SyscallsNonBlockingWithData)
+{
+    sendFromDevice("data");
+
+    SyscallCounter counter;
+    int result = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, nullptr);
+
+    EXPECT_EQ(result, 4);
+    EXPECT_EQ(counter.counts().ioctl, 1);
+    EXPECT_EQ(counter.counts().read, 1);
+    EXPECT_EQ(counter.counts().total(), 2);
+}
+
+TEST_F(SerialReadPtyTest, NanosecondTimeoutIsNotRoundedUpToMilliseconds)
+{
+    // poll() would wait at least 1 ms per call, 20 ms in total.
+    constexpr int kCalls = 20;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kCalls; ++i)
+    {
+        ASSERT_EQ(serialReadNs(handle, buffer.data(), static_cast<int>(buffer.size()), 200'000, nullptr), 0);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, kCalls * std::chrono::microseconds(200));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(15));
+}
+
+TEST_F(SerialReadPtyTest, NanosecondReadUsesTheSamePath)
+{
+    sendFromDevice("data");
+
+    SyscallCounter counter;
+    int result = serialReadNs(handle, buffer.data(), static_cast<int>(buffer.size()), 500'000, nullptr);
+
+    EXPECT_EQ(result, 4);
+    EXPECT_EQ(counter.counts().poll, 1);
+    EXPECT_EQ(counter.counts().read, 1);
+    EXPECT_EQ(counter.counts().total(), 2);
+    EXPECT_EQ(serialReadNs(-1, buffer.data(), 1, 0, nullptr),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
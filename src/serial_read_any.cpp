@@ -0,0 +1,137 @@
+#include <cpp_bindings_linux/interface/serial_read_any.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <array>
+#include <cerrno>
+#include <limits>
+#include <poll.h>
+#include <unistd.h>
+
+extern "C"
+{
+    MODULE_API auto serialReadAny(const int64_t *handles, void *const *buffers, const int *buffer_sizes, int count,
+                                  SerialReadAnyResult *results, int timeout_ms, ErrorCallbackT error_callback) -> int
+    {
+        if (handles == nullptr || buffers == nullptr || buffer_sizes == nullptr || results == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid handles, buffers, buffer_sizes or results");
+        }
+
+        if (count <= 0 || count > kSerialReadAnyMaxHandles)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid count");
+        }
+
+        if (timeout_ms < 0)
+        {
+            timeout_ms = 0;
+        }
+
+        std::array<struct pollfd, kSerialReadAnyMaxHandles> poll_fds{};
+        for (int i = 0; i < count; ++i)
+        {
+            if (buffers[i] == nullptr || buffer_sizes[i] <= 0)
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid buffer or buffer_size");
+            }
+            if (handles[i] <= 0 || handles[i] > std::numeric_limits<int>::max())
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(
+                    error_callback, cpp_core::StatusCodes::kInvalidHandleError, "Invalid handle");
+            }
+            poll_fds[i].fd = static_cast<int>(handles[i]);
+            poll_fds[i].events = POLLIN;
+        }
+
+        // Bytes a transaction kept (see serialTransact()) are already received: report them without waiting.
+        std::array<bool, kSerialReadAnyMaxHandles> carried{};
+        bool any_carried = false;
+        for (int i = 0; i < count; ++i)
+        {
+            auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(poll_fds[i].fd);
+            const auto side_lock = cpp_bindings_linux::detail::lockReadSide(state);
+            carried[static_cast<std::size_t>(i)] = state != nullptr && state->read.carry.size > 0;
+            any_carried = any_carried || carried[static_cast<std::size_t>(i)];
+        }
+        if (any_carried)
+        {
+            timeout_ms = 0;
+        }
+
+        int poll_result = 0;
+        do
+        {
+            poll_result = poll(poll_fds.data(), static_cast<nfds_t>(count), timeout_ms);
+        } while (poll_result < 0 && errno == EINTR);
+
+        if (poll_result < 0)
+        {
+            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
+        }
+        if (poll_result == 0 && !any_carried)
+        {
+            return 0;
+        }
+
+        // Reject closed descriptors before consuming data from any of the others.
+        for (int i = 0; i < count; ++i)
+        {
+            if ((poll_fds[i].revents & POLLNVAL) != 0)
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(
+                    error_callback, cpp_core::StatusCodes::kInvalidHandleError, "Invalid handle");
+            }
+        }
+
+        int result_count = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            // A hung-up port is read too, so its error is reported instead of the port being polled forever.
+            const bool ready = (poll_fds[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+            if (!ready && !carried[static_cast<std::size_t>(i)])
+            {
+                continue;
+            }
+
+            auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(poll_fds[i].fd);
+            const auto side_lock = cpp_bindings_linux::detail::lockReadSide(state);
+            if (cpp_bindings_linux::detail::rejectFanoutRead(state, error_callback) ||
+                cpp_bindings_linux::detail::rejectCompressedRead(state, error_callback))
+            {
+                results[result_count++] = {handles[i], static_cast<int32_t>(cpp_core::StatusCodes::kReadError), i};
+                continue;
+            }
+            ssize_t bytes = cpp_bindings_linux::detail::takeCarried(state, buffers[i], buffer_sizes[i]);
+            if (bytes == 0 && ready)
+            {
+                bytes = cpp_bindings_linux::detail::readAfterReady(poll_fds[i].fd, buffers[i], buffer_sizes[i]);
+            }
+            cpp_bindings_linux::detail::recordRead(state, bytes);
+            if (bytes == 0)
+            {
+                continue;
+            }
+
+            SerialReadAnyResult &entry = results[result_count++];
+            entry.handle = handles[i];
+            entry.index = i;
+            if (bytes < 0)
+            {
+                // Keep going: data already read from other handles must not be lost because one port failed.
+                entry.bytes_read = cpp_bindings_linux::detail::failErrno<int32_t>(error_callback,
+                                                                                  cpp_core::StatusCodes::kReadError);
+                continue;
+            }
+            entry.bytes_read = static_cast<int32_t>(bytes);
+        }
+
+        return result_count;
+    }
+
+} // extern "C"
@@ -0,0 +1,145 @@
+#include <cpp_bindings_linux/interface/serial_read_any.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+
+class SerialReadAnyTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        for (auto &pipe_fds : pipes)
+        {
+            ASSERT_EQ(pipe(pipe_fds.data()), 0);
+            fcntl(pipe_fds[0], F_SETFL, O_NONBLOCK);
+            fcntl(pipe_fds[1], F_SETFL, O_NONBLOCK);
+        }
+        for (size_t i = 0; i < pipes.size(); ++i)
+        {
+            handles[i] = pipes[i][0];
+            buffer_ptrs[i] = buffers[i].data();
+            buffer_sizes[i] = static_cast<int>(buffers[i].size());
+        }
+    }
+
+    void TearDown() override
+    {
+        for (auto &pipe_fds : pipes)
+        {
+            close(pipe_fds[0]);
+            close(pipe_fds[1]);
+        }
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+
+    std::array<std::array<int, 2>, 3> pipes{};
+    std::array<int64_t, 3> handles{};
+    std::array<std::array<char, 16>, 3> buffers{};
+    std::array<void *, 3> buffer_ptrs{};
+    std::array<int, 3> buffer_sizes{};
+    std::array<SerialReadAnyResult, 3> results{};
+};
+
+TEST_F(SerialReadAnyTest, NullArguments)
+{
+    int result = serialReadAny(nullptr, buffer_ptrs.data(), buffer_sizes.data(), 3, results.data(), 0, error_callback);
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+
+    result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 3, nullptr, 0, error_callback);
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialReadAnyTest, InvalidCount)
+{
+    int result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 0, results.data(), 0,
+                               error_callback);
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+
+    result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), kSerialReadAnyMaxHandles + 1,
+                           results.data(), 0, error_callback);
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialReadAnyTest, InvalidHandle)
+{
+    handles[1] = -1;
+    int result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 3, results.data(), 0,
+                               error_callback);
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
+
+TEST_F(SerialReadAnyTest, InvalidBufferSize)
+{
+    buffer_sizes[2] = 0;
+    int result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 3, results.data(), 0,
+                               error_callback);
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialReadAnyTest, TimeoutWhenNothingReadable)
+{
+    const auto start = std::chrono::steady_clock::now();
+    int result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 3, results.data(), 50,
+                               error_callback);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(result, 0);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(40));
+}
+
+TEST_F(SerialReadAnyTest, ReadsOnlyReadyHandle)
+{
+    const char *message = "ping";
+    ASSERT_EQ(write(pipes[1][1], message, strlen(message)), static_cast<ssize_t>(strlen(message)));
+
+    int result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 3, results.data(), 100,
+                               error_callback);
+
+    ASSERT_EQ(result, 1);
+    EXPECT_EQ(results[0].handle, handles[1]);
+    EXPECT_EQ(results[0].index, 1);
+    EXPECT_EQ(results[0].bytes_read, static_cast<int32_t>(strlen(message)));
+    EXPECT_EQ(std::string(buffers[1].data(), strlen(message)), message);
+}
+
+TEST_F(SerialReadAnyTest, ReadsEveryReadyHandleInOneCall)
+{
+    ASSERT_EQ(write(pipes[0][1], "first", 5), 5);
+    ASSERT_EQ(write(pipes[2][1], "third!", 6), 6);
+
+    int result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 3, results.data(), 100,
+                               error_callback);
+
+    ASSERT_EQ(result, 2);
+    EXPECT_EQ(results[0].handle, handles[0]);
+    EXPECT_EQ(results[0].bytes_read, 5);
+    EXPECT_EQ(std::string(buffers[0].data(), 5), "first");
+    EXPECT_EQ(results[1].handle, handles[2]);
+    EXPECT_EQ(results[1].bytes_read, 6);
+    EXPECT_EQ(std::string(buffers[2].data(), 6), "third!");
+}
+
+TEST_F(SerialReadAnyTest, ClosedHandleIsRejected)
+{
+    close(pipes[0][0]);
+    pipes[0][0] = -1;
+
+    int result = serialReadAny(handles.data(), buffer_ptrs.data(), buffer_sizes.data(), 3, results.data(), 0,
+                               error_callback);
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
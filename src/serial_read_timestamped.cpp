@@ -0,0 +1,112 @@
+#include <cpp_bindings_linux/interface/serial_read_timestamped.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+#include "detail/read_loop.hpp"
+
+#include <limits>
+#include <unistd.h>
+
+namespace
+{
+// Records the timestamp of the single read() of a call; the clock is sampled at the readiness wakeup, not at read().
+class TimestampRecorder
+{
+  public:
+    explicit TimestampRecorder(SerialRxTimestamp *record) : record_(record)
+    {
+    }
+
+    auto onReady() -> void
+    {
+        wakeup_ns_ = cpp_bindings_linux::detail::monotonicNowNs();
+    }
+
+    auto onChunk(int offset, int size) -> void
+    {
+        *record_ = SerialRxTimestamp{offset, size, wakeup_ns_};
+        count_ = 1;
+    }
+
+    [[nodiscard]] auto count() const -> int
+    {
+        return count_;
+    }
+
+  private:
+    SerialRxTimestamp *record_;
+    int count_ = 0;
+    int64_t wakeup_ns_ = 0;
+};
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialReadTimestamped(int64_t handle, void *buffer, int buffer_size, int timeout_ms,
+                                          int /*multiplier*/, SerialRxTimestamp *timestamps, int timestamp_capacity,
+                                          int *timestamp_count, ErrorCallbackT error_callback) -> int
+    {
+        if (timestamp_count != nullptr)
+        {
+            *timestamp_count = 0;
+        }
+
+        if (buffer == nullptr || buffer_size <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer or buffer_size");
+        }
+
+        if (timestamps == nullptr || timestamp_capacity <= 0 || timestamp_count == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(
+                error_callback, cpp_core::StatusCodes::kBufferError,
+                "Invalid timestamps, timestamp_capacity or timestamp_count");
+        }
+
+        if (handle <= 0 || handle > std::numeric_limits<int>::max())
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                            "Invalid handle");
+        }
+
+        if (timeout_ms < 0)
+        {
+            timeout_ms = 0;
+        }
+
+        const int fd = static_cast<int>(handle);
+        auto *buf = static_cast<unsigned char *>(buffer);
+
+        auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+        const auto side_lock = cpp_bindings_linux::detail::lockReadSide(state);
+        if (cpp_bindings_linux::detail::rejectFanoutRead(state, error_callback) ||
+            cpp_bindings_linux::detail::rejectCompressedRead(state, error_callback))
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kReadError);
+        }
+
+        TimestampRecorder recorder(timestamps);
+        ssize_t total_read = cpp_bindings_linux::detail::takeCarried(state, buf, buffer_size);
+        if (total_read > 0)
+        {
+            // Bytes a transaction kept carry the time of the read() that received them.
+            *timestamps = SerialRxTimestamp{0, static_cast<int32_t>(total_read), state->read.carry.received_ns};
+            *timestamp_count = 1;
+            cpp_bindings_linux::detail::recordRead(state, total_read);
+            return static_cast<int>(total_read);
+        }
+        total_read = cpp_bindings_linux::detail::readWithTimeout(fd, buf, buffer_size, timeout_ms, recorder);
+        if (total_read < 0)
+        {
+            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kReadError);
+        }
+
+        cpp_bindings_linux::detail::recordRead(state, total_read);
+
+        *timestamp_count = recorder.count();
+        return static_cast<int>(total_read);
+    }
+
+} // extern "C"
@@ -0,0 +1,119 @@
+#include <cpp_bindings_linux/interface/serial_read_timestamped.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <ctime>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+
+namespace
+{
+auto monotonicNs() -> int64_t
+{
+    struct timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<int64_t>(now.tv_sec) * 1'000'000'000) + now.tv_nsec;
+}
+} // namespace
+
+class SerialReadTimestampedTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        ASSERT_EQ(pipe(pipefd.data()), 0);
+        fcntl(pipefd[0], F_SETFL, O_NONBLOCK);
+        fcntl(pipefd[1], F_SETFL, O_NONBLOCK);
+    }
+
+    void TearDown() override
+    {
+        close(pipefd[0]);
+        close(pipefd[1]);
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+
+    std::array<int, 2> pipefd{};
+    std::array<char, 32> buffer{};
+    std::array<SerialRxTimestamp, 4> stamps{};
+    int stamp_count = -1;
+};
+
+TEST_F(SerialReadTimestampedTest, NullTimestamps)
+{
+    int result = serialReadTimestamped(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 0, 0, nullptr, 4,
+                                       &stamp_count, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(stamp_count, 0);
+}
+
+TEST_F(SerialReadTimestampedTest, ZeroCapacity)
+{
+    int result = serialReadTimestamped(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 0, 0,
+                                       stamps.data(), 0, &stamp_count, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialReadTimestampedTest, InvalidHandle)
+{
+    int result = serialReadTimestamped(-1, buffer.data(), static_cast<int>(buffer.size()), 0, 0, stamps.data(),
+                                       static_cast<int>(stamps.size()), &stamp_count, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
+
+TEST_F(SerialReadTimestampedTest, TimeoutProducesNoRecords)
+{
+    int result = serialReadTimestamped(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 10, 0,
+                                       stamps.data(), static_cast<int>(stamps.size()), &stamp_count, error_callback);
+
+    EXPECT_EQ(result, 0);
+    EXPECT_EQ(stamp_count, 0);
+}
+
+TEST_F(SerialReadTimestampedTest, RecordCoversReadData)
+{
+    const std::string message = "timestamped";
+    ASSERT_EQ(write(pipefd[1], message.data(), message.size()), static_cast<ssize_t>(message.size()));
+
+    const int64_t before = monotonicNs();
+    int result = serialReadTimestamped(pipefd[0], buffer.data(), static_cast<int>(buffer.size()), 100, 0,
+                                       stamps.data(), static_cast<int>(stamps.size()), &stamp_count, error_callback);
+    const int64_t after = monotonicNs();
+
+    ASSERT_EQ(result, static_cast<int>(message.size()));
+    EXPECT_EQ(std::string(buffer.data(), message.size()), message);
+    ASSERT_EQ(stamp_count, 1);
+    EXPECT_EQ(stamps[0].offset, 0);
+    EXPECT_EQ(stamps[0].length, result);
+    EXPECT_GE(stamps[0].monotonic_ns, before);
+    EXPECT_LE(stamps[0].monotonic_ns, after);
+}
+
+TEST_F(SerialReadTimestampedTest, RecordsSpanWholeResult)
+{
+    // More data queued than the caller buffer holds: the one record covers exactly the returned bytes.
+    std::array<char, 8> small_buffer{};
+    ASSERT_EQ(write(pipefd[1], "0123456789", 10), 10);
+
+    int result = serialReadTimestamped(pipefd[0], small_buffer.data(), static_cast<int>(small_buffer.size()), 100, 0,
+                                       stamps.data(), static_cast<int>(stamps.size()), &stamp_count, error_callback);
+
+    ASSERT_EQ(result, 8);
+    ASSERT_EQ(stamp_count, 1);
+    EXPECT_EQ(stamps[0].offset, 0);
+    EXPECT_EQ(stamps[0].length, result);
+}
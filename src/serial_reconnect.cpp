@@ -0,0 +1,69 @@
+#include <cpp_bindings_linux/interface/serial_reconnect.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+#include "detail/reconnect_supervisor.hpp"
+
+#include <limits>
+#include <poll.h>
+
+extern "C"
+{
+    MODULE_API auto serialEnableReconnect(int64_t handle, const char *usb_serial_number,
+                                          ErrorCallbackT error_callback) -> int
+    {
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        const auto added = cpp_bindings_linux::detail::ReconnectSupervisor::instance().add(
+            static_cast<int>(handle), usb_serial_number != nullptr ? usb_serial_number : "");
+        if (!added)
+        {
+            return cpp_bindings_linux::detail::failError<int>(error_callback, added.error());
+        }
+        state->reconnect.store(true, std::memory_order_relaxed);
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialDisableReconnect(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        if (state->reconnect.exchange(false, std::memory_order_relaxed))
+        {
+            cpp_bindings_linux::detail::ReconnectSupervisor::instance().remove(static_cast<int>(handle));
+        }
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialIsConnected(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        if (handle <= 0 || handle > std::numeric_limits<int>::max())
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(
+                error_callback, cpp_core::StatusCodes::kInvalidHandleError, "Invalid handle");
+        }
+
+        // No events requested: only the conditions poll() always reports (hangup, error, closed fd) come back.
+        struct pollfd poll_fd = {static_cast<int>(handle), 0, 0};
+        if (poll(&poll_fd, 1, 0) < 0)
+        {
+            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kGetStateError);
+        }
+        if ((poll_fd.revents & POLLNVAL) != 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(
+                error_callback, cpp_core::StatusCodes::kInvalidHandleError, "Invalid handle");
+        }
+        return (poll_fd.revents & POLLHUP) != 0 ? 0 : 1;
+    }
+
+} // extern "C"
@@ -0,0 +1,188 @@
+#include <cpp_bindings_linux/interface/serial_fanout.h>
+#include <cpp_bindings_linux/interface/serial_reconnect.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_open.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+// Simulates unplugging the adapter: the device end goes away and the tty reports a hangup.
+auto unplug(PtyPair &pty) -> void
+{
+    close(pty.master_fd);
+    pty.master_fd = -1;
+}
+
+auto waitConnected(int64_t handle, int expected, int timeout_ms = 2000) -> bool
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (serialIsConnected(handle, nullptr) == expected)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+} // namespace
+
+class SerialReconnectTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+    }
+
+    void TearDown() override
+    {
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+};
+
+TEST_F(SerialReconnectTest, InvalidHandles)
+{
+    EXPECT_EQ(serialEnableReconnect(-1, nullptr, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialDisableReconnect(0, error_callback), static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialIsConnected(-1, error_callback), static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+
+    // stdin was not opened through serialOpen(), so there is no configuration to reopen it with.
+    EXPECT_EQ(serialEnableReconnect(STDIN_FILENO + 1000, nullptr, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(error_capture.last_message, "Handle was not opened with serialOpen");
+}
+
+TEST_F(SerialReconnectTest, HangupIsAnErrorNotATimeout)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+    EXPECT_EQ(serialIsConnected(handle, error_callback), 1);
+
+    unplug(pty);
+    EXPECT_EQ(serialIsConnected(handle, error_callback), 0);
+
+    std::array<char, 16> buffer{};
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kReadError));
+    EXPECT_EQ(serialWrite(handle, "x", 1, 1000, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kWriteError));
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(500));
+
+    serialClose(handle, nullptr);
+}
+
+TEST_F(SerialReconnectTest, ReopensUnderTheSameHandle)
+{
+    PtyPair first;
+    if (!first.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    // A stable name for the device, like /dev/serial/by-id or a udev rule would provide.
+    std::string dir = "/tmp/serial_reconnect_XXXXXX";
+    ASSERT_NE(mkdtemp(dir.data()), nullptr);
+    const std::string link = dir + "/device";
+    ASSERT_EQ(symlink(first.slave_path.c_str(), link.c_str()), 0);
+
+    const int64_t handle = serialOpen(const_cast<char *>(link.c_str()), 115200, 8, 0, 1, error_callback);
+    ASSERT_GT(handle, 0);
+    ASSERT_EQ(serialEnableReconnect(handle, nullptr, error_callback), 0);
+
+    unlink(link.c_str());
+    unplug(first);
+    EXPECT_TRUE(waitConnected(handle, 0));
+
+    PtyPair second;
+    ASSERT_TRUE(second.valid());
+    ASSERT_EQ(symlink(second.slave_path.c_str(), link.c_str()), 0);
+    ASSERT_TRUE(waitConnected(handle, 1));
+
+    ASSERT_EQ(write(second.master_fd, "back", 4), 4);
+    ASSERT_TRUE(PtyPair::waitQueued(handle, 4));
+    std::array<char, 16> buffer{};
+    ASSERT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, error_callback), 4);
+    EXPECT_EQ(std::string(buffer.data(), 4), "back");
+
+    EXPECT_EQ(serialWrite(handle, "hi", 2, 100, 0, error_callback), 2);
+    std::array<char, 4> echoed{};
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(read(second.master_fd, echoed.data(), echoed.size()), 2);
+
+    EXPECT_EQ(serialDisableReconnect(handle, error_callback), 0);
+    serialClose(handle, nullptr);
+    unlink(link.c_str());
+    rmdir(dir.c_str());
+}
+
+TEST_F(SerialReconnectTest, FanoutResumesAfterReopen)
+{
+    PtyPair first;
+    if (!first.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    std::string dir = "/tmp/serial_reconnect_XXXXXX";
+    ASSERT_NE(mkdtemp(dir.data()), nullptr);
+    const std::string link = dir + "/device";
+    ASSERT_EQ(symlink(first.slave_path.c_str(), link.c_str()), 0);
+
+    const int64_t handle = serialOpen(const_cast<char *>(link.c_str()), 115200, 8, 0, 1, error_callback);
+    ASSERT_GT(handle, 0);
+    ASSERT_EQ(serialEnableReconnect(handle, nullptr, error_callback), 0);
+    ASSERT_EQ(serialSetFanout(handle, 64, kSerialFanoutDrop, error_callback), 0);
+    const int64_t subscriber = serialFanoutSubscribe(handle, error_callback);
+    ASSERT_GT(subscriber, 0);
+
+    // The subscriber learns about the hangup ...
+    unlink(link.c_str());
+    unplug(first);
+    std::array<char, 16> buffer{};
+    EXPECT_EQ(serialFanoutRead(handle, subscriber, buffer.data(), static_cast<int>(buffer.size()), 1000, nullptr),
+              static_cast<int>(cpp_core::StatusCodes::kReadError));
+    EXPECT_TRUE(waitConnected(handle, 0));
+
+    // ... and receives the new device's bytes once it is back.
+    PtyPair second;
+    ASSERT_TRUE(second.valid());
+    ASSERT_EQ(symlink(second.slave_path.c_str(), link.c_str()), 0);
+    ASSERT_TRUE(waitConnected(handle, 1));
+    ASSERT_EQ(write(second.master_fd, "back", 4), 4);
+    ASSERT_EQ(serialFanoutRead(handle, subscriber, buffer.data(), static_cast<int>(buffer.size()), 1000,
+                               error_callback),
+              4);
+    EXPECT_EQ(std::string(buffer.data(), 4), "back");
+
+    EXPECT_EQ(serialDisableReconnect(handle, error_callback), 0);
+    serialClose(handle, nullptr);
+    unlink(link.c_str());
+    rmdir(dir.c_str());
+}
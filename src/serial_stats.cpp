@@ -0,0 +1,33 @@
+#include <cpp_bindings_linux/interface/serial_stats.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <atomic>
+
+extern "C"
+{
+    MODULE_API auto serialGetStats(int64_t handle, SerialPortStats *stats, ErrorCallbackT error_callback) -> int
+    {
+        if (stats == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid stats");
+        }
+
+        const auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        stats->rx_bytes = state->read.bytes.load(std::memory_order_relaxed);
+        stats->tx_bytes = state->write.bytes.load(std::memory_order_relaxed);
+        stats->read_calls = state->read.calls.load(std::memory_order_relaxed);
+        stats->write_calls = state->write.calls.load(std::memory_order_relaxed);
+
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+} // extern "C"
@@ -0,0 +1,89 @@
+#include <cpp_bindings_linux/interface/serial_stats.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+class SerialStatsTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+    }
+
+    void TearDown() override
+    {
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+};
+
+TEST_F(SerialStatsTest, NullStats)
+{
+    int result = serialGetStats(1, nullptr, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialStatsTest, InvalidHandle)
+{
+    SerialPortStats stats{};
+    int result = serialGetStats(-1, &stats, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
+
+TEST_F(SerialStatsTest, DescriptorNotOpenedBySerialOpen)
+{
+    std::array<int, 2> pipefd{};
+    ASSERT_EQ(pipe(pipefd.data()), 0);
+
+    SerialPortStats stats{};
+    int result = serialGetStats(pipefd[0], &stats, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    close(pipefd[0]);
+    close(pipefd[1]);
+}
+
+TEST_F(SerialStatsTest, CountsTrafficAndForgetsHandleOnClose)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    ASSERT_EQ(serialWrite(handle, "abc", 3, 100, 0, error_callback), 3);
+    ASSERT_EQ(write(pty.master_fd, "hello", 5), 5);
+    ASSERT_TRUE(PtyPair::waitQueued(handle, 5));
+    std::array<char, 16> buffer{};
+    ASSERT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, error_callback), 5);
+    ASSERT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, error_callback), 0);
+
+    SerialPortStats stats{};
+    ASSERT_EQ(serialGetStats(handle, &stats, error_callback), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+    EXPECT_EQ(stats.tx_bytes, 3U);
+    EXPECT_EQ(stats.write_calls, 1U);
+    EXPECT_EQ(stats.rx_bytes, 5U);
+    EXPECT_EQ(stats.read_calls, 2U);
+
+    ASSERT_EQ(serialClose(handle, error_callback), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+    EXPECT_EQ(serialGetStats(handle, &stats, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
@@ -0,0 +1,305 @@
+#include <cpp_bindings_linux/interface/serial_submit.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <limits>
+#include <mutex>
+#include <poll.h>
+#include <unistd.h>
+
+namespace
+{
+struct Progress
+{
+    int fd = -1;
+    bool is_read = true;
+    bool finished = false;
+    int transferred = 0;
+    int error_number = 0; // errno of a failed syscall
+    int64_t deadline_ns = 0;
+    bool rejected = false; // refused before the batch started, already reported
+    cpp_bindings_linux::detail::PortState *state = nullptr;
+};
+
+// Serializes with other users of the same handle side. Locks are taken in address order, so two batches that
+// share handles cannot deadlock. serialTransact(), serialSetCompression() and the reconnect supervisor lock both
+// sides of one handle, but through std::lock()/std::scoped_lock, which never blocks on one mutex while holding
+// another, so they cannot close a cycle with this order. Every other entry point holds one side lock at a time.
+struct SideLocks
+{
+    std::array<std::mutex *, kSerialSubmitMaxOperations> mutexes{};
+    int count = 0;
+    int locked = 0;
+
+    auto add(std::mutex *mutex) -> void
+    {
+        mutexes[static_cast<std::size_t>(count++)] = mutex;
+    }
+
+    auto lockAll() -> void
+    {
+        std::sort(mutexes.begin(), mutexes.begin() + count);
+        count = static_cast<int>(std::unique(mutexes.begin(), mutexes.begin() + count) - mutexes.begin());
+        for (; locked < count; ++locked)
+        {
+            mutexes[static_cast<std::size_t>(locked)]->lock();
+        }
+    }
+
+    ~SideLocks()
+    {
+        for (int i = locked - 1; i >= 0; --i)
+        {
+            mutexes[static_cast<std::size_t>(i)]->unlock();
+        }
+    }
+};
+
+// One non-blocking step. Returns true once the operation is finished (done, failed, or hung up).
+auto advance(const SerialOperation &operation, Progress &progress) -> bool
+{
+    if (progress.is_read)
+    {
+        // Bytes a transaction kept come before anything still queued.
+        ssize_t bytes =
+            cpp_bindings_linux::detail::takeCarried(progress.state, operation.buffer, operation.buffer_size);
+        if (bytes == 0)
+        {
+            bytes = cpp_bindings_linux::detail::readNonBlocking(progress.fd, operation.buffer, operation.buffer_size);
+        }
+        if (bytes < 0)
+        {
+            progress.error_number = errno;
+            return true;
+        }
+        progress.transferred = static_cast<int>(bytes);
+        return bytes > 0;
+    }
+
+    const auto *source = static_cast<const unsigned char *>(operation.buffer);
+    while (progress.transferred < operation.buffer_size)
+    {
+        const ssize_t bytes = ::write(progress.fd, source + progress.transferred,
+                                      static_cast<size_t>(operation.buffer_size - progress.transferred));
+        if (bytes > 0)
+        {
+            progress.transferred += static_cast<int>(bytes);
+            continue;
+        }
+        if (bytes < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            progress.error_number = errno;
+            return true;
+        }
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialSubmit(const SerialOperation *operations, int32_t *results, int count,
+                                 ErrorCallbackT error_callback) -> int
+    {
+        if (operations == nullptr || results == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid operations or results");
+        }
+
+        if (count <= 0 || count > kSerialSubmitMaxOperations)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid count");
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            const SerialOperation &operation = operations[i];
+            if (operation.op != kSerialOperationRead && operation.op != kSerialOperationWrite)
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid operation kind");
+            }
+            if (operation.buffer == nullptr || operation.buffer_size <= 0)
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid buffer or buffer_size");
+            }
+            if (operation.reserved != 0)
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                "Invalid reserved: must be 0");
+            }
+            if (operation.handle <= 0 || operation.handle > std::numeric_limits<int>::max())
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(
+                    error_callback, cpp_core::StatusCodes::kInvalidHandleError, "Invalid handle");
+            }
+        }
+
+        const int64_t start_ns = cpp_bindings_linux::detail::monotonicNowNs();
+        std::array<Progress, kSerialSubmitMaxOperations> progress{};
+        SideLocks locks;
+        for (int i = 0; i < count; ++i)
+        {
+            const SerialOperation &operation = operations[i];
+            Progress &entry = progress[static_cast<std::size_t>(i)];
+            entry.fd = static_cast<int>(operation.handle);
+            entry.is_read = operation.op == kSerialOperationRead;
+            entry.deadline_ns = start_ns + (static_cast<int64_t>(std::max(operation.timeout_ms, 0)) * 1'000'000);
+            entry.state = cpp_bindings_linux::detail::PortRegistry::instance().find(entry.fd);
+            if (entry.state != nullptr)
+            {
+                locks.add(entry.is_read ? &entry.state->read.mutex : &entry.state->write.mutex);
+            }
+        }
+        locks.lockAll();
+
+        // Sides in fan-out or compressed-stream mode are not read or written directly; such operations fail without
+        // touching the port.
+        for (int i = 0; i < count; ++i)
+        {
+            Progress &entry = progress[static_cast<std::size_t>(i)];
+            entry.rejected =
+                entry.is_read ? cpp_bindings_linux::detail::rejectFanoutRead(entry.state, error_callback) ||
+                                    cpp_bindings_linux::detail::rejectCompressedRead(entry.state, error_callback)
+                              : cpp_bindings_linux::detail::rejectCompressedWrite(entry.state, error_callback);
+            entry.finished = entry.rejected;
+        }
+
+        // An operation may run once every earlier operation on the same handle and direction has finished.
+        const auto isRunnable = [&](int index) {
+            const Progress &entry = progress[static_cast<std::size_t>(index)];
+            for (int j = 0; j < index; ++j)
+            {
+                const Progress &earlier = progress[static_cast<std::size_t>(j)];
+                if (!earlier.finished && earlier.fd == entry.fd && earlier.is_read == entry.is_read)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::array<struct pollfd, kSerialSubmitMaxOperations> poll_fds{};
+        std::array<int, kSerialSubmitMaxOperations> polled_index{};
+        while (true)
+        {
+            const int64_t now_ns = cpp_bindings_linux::detail::monotonicNowNs();
+            int64_t next_deadline_ns = std::numeric_limits<int64_t>::max();
+            int polled = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                Progress &entry = progress[static_cast<std::size_t>(i)];
+                if (entry.finished || !isRunnable(i))
+                {
+                    continue;
+                }
+                entry.finished = advance(operations[i], entry) || entry.deadline_ns <= now_ns;
+                if (entry.finished)
+                {
+                    // A later operation on the same side may have become runnable; the next pass picks it up.
+                    next_deadline_ns = now_ns;
+                    continue;
+                }
+                poll_fds[static_cast<std::size_t>(polled)] = {entry.fd,
+                                                              static_cast<short>(entry.is_read ? POLLIN : POLLOUT), 0};
+                polled_index[static_cast<std::size_t>(polled)] = i;
+                ++polled;
+                next_deadline_ns = std::min(next_deadline_ns, entry.deadline_ns);
+            }
+
+            if (polled == 0)
+            {
+                if (std::all_of(progress.begin(), progress.begin() + count,
+                                [](const Progress &entry) { return entry.finished; }))
+                {
+                    break;
+                }
+                continue;
+            }
+
+            const int64_t wait_ns = std::max<int64_t>(next_deadline_ns - now_ns, 0);
+            const int poll_result =
+                poll(poll_fds.data(), static_cast<nfds_t>(polled), static_cast<int>((wait_ns + 999'999) / 1'000'000));
+            if (poll_result < 0 && errno != EINTR)
+            {
+                for (int p = 0; p < polled; ++p)
+                {
+                    Progress &entry = progress[static_cast<std::size_t>(polled_index[static_cast<std::size_t>(p)])];
+                    entry.error_number = errno;
+                    entry.finished = true;
+                }
+                continue;
+            }
+
+            for (int p = 0; p < polled && poll_result > 0; ++p)
+            {
+                const short revents = poll_fds[static_cast<std::size_t>(p)].revents;
+                Progress &entry = progress[static_cast<std::size_t>(polled_index[static_cast<std::size_t>(p)])];
+                if ((revents & POLLNVAL) != 0)
+                {
+                    entry.error_number = EBADF;
+                    entry.finished = true;
+                }
+                else if ((revents & (POLLHUP | POLLERR)) != 0)
+                {
+                    // Let the syscall report the condition; if it has nothing to say, report the hangup itself
+                    // instead of polling the dead port again.
+                    const int transferred_before = entry.transferred;
+                    entry.finished = advance(operations[polled_index[static_cast<std::size_t>(p)]], entry);
+                    if (!entry.finished && entry.transferred == transferred_before)
+                    {
+                        entry.error_number = (revents & POLLHUP) != 0 ? ENODEV : EIO;
+                        entry.finished = true;
+                    }
+                }
+            }
+        }
+
+        int succeeded = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            const Progress &entry = progress[static_cast<std::size_t>(i)];
+            if (entry.rejected)
+            {
+                results[i] = static_cast<int32_t>(entry.is_read ? cpp_core::StatusCodes::kReadError
+                                                                : cpp_core::StatusCodes::kWriteError);
+                continue;
+            }
+            if (entry.error_number != 0)
+            {
+                const auto code = entry.error_number == EBADF ? cpp_core::StatusCodes::kInvalidHandleError
+                                  : entry.is_read             ? cpp_core::StatusCodes::kReadError
+                                                              : cpp_core::StatusCodes::kWriteError;
+                errno = entry.error_number;
+                results[i] = cpp_bindings_linux::detail::failErrno<int32_t>(error_callback, code);
+                continue;
+            }
+
+            results[i] = entry.transferred;
+            ++succeeded;
+            if (entry.is_read)
+            {
+                cpp_bindings_linux::detail::recordRead(entry.state, entry.transferred);
+            }
+            else
+            {
+                cpp_bindings_linux::detail::recordWrite(entry.state, entry.transferred);
+            }
+        }
+        return succeeded;
+    }
+
+} // extern "C"
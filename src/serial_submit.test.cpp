@@ -0,0 +1,226 @@
+#include <cpp_bindings_linux/interface/serial_stats.h>
+#include <cpp_bindings_linux/interface/serial_submit.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <fcntl.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+class SerialSubmitTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        ASSERT_EQ(pipe2(pipe_a.data(), O_NONBLOCK), 0);
+        ASSERT_EQ(pipe2(pipe_b.data(), O_NONBLOCK), 0);
+    }
+
+    void TearDown() override
+    {
+        for (const int fd : {pipe_a[0], pipe_a[1], pipe_b[0], pipe_b[1]})
+        {
+            close(fd);
+        }
+        ErrorCapture::instance = nullptr;
+    }
+
+    static auto readOp(int fd, void *buffer, int size, int timeout_ms) -> SerialOperation
+    {
+        return {fd, kSerialOperationRead, size, buffer, timeout_ms, 0};
+    }
+
+    static auto writeOp(int fd, const char *data, int timeout_ms) -> SerialOperation
+    {
+        return {fd, kSerialOperationWrite, static_cast<int32_t>(std::char_traits<char>::length(data)),
+                const_cast<char *>(data), timeout_ms, 0};
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    std::array<int, 2> pipe_a{};
+    std::array<int, 2> pipe_b{};
+};
+
+TEST_F(SerialSubmitTest, InvalidArguments)
+{
+    std::array<int32_t, 1> results{};
+    std::array<char, 4> buffer{};
+    const std::array<SerialOperation, 1> bad_kind = {{{pipe_a[0], 7, 4, buffer.data(), 0, 0}}};
+
+    EXPECT_EQ(serialSubmit(nullptr, results.data(), 1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSubmit(bad_kind.data(), results.data(), 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSubmit(bad_kind.data(), results.data(), 1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(error_capture.last_message, "Invalid operation kind");
+
+    const std::array<SerialOperation, 1> bad_reserved = {{{pipe_a[0], kSerialOperationRead, 4, buffer.data(), 0, 1}}};
+    EXPECT_EQ(serialSubmit(bad_reserved.data(), results.data(), 1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(error_capture.last_message, "Invalid reserved: must be 0");
+
+    const std::array<SerialOperation, 1> bad_handle = {{readOp(-1, buffer.data(), 4, 0)}};
+    EXPECT_EQ(serialSubmit(bad_handle.data(), results.data(), 1, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
+
+TEST_F(SerialSubmitTest, WritesAndReadsAcrossHandlesInOneCall)
+{
+    ASSERT_EQ(write(pipe_b[1], "ready", 5), 5);
+
+    std::array<char, 16> from_a{};
+    std::array<char, 16> from_b{};
+    const std::array<SerialOperation, 3> operations = {{
+        writeOp(pipe_a[1], "request", 100),
+        readOp(pipe_a[0], from_a.data(), static_cast<int>(from_a.size()), 100),
+        readOp(pipe_b[0], from_b.data(), static_cast<int>(from_b.size()), 100),
+    }};
+    std::array<int32_t, 3> results{};
+
+    EXPECT_EQ(serialSubmit(operations.data(), results.data(), 3, error_callback), 3);
+    EXPECT_EQ(results[0], 7);
+    EXPECT_EQ(results[1], 7);
+    EXPECT_EQ(std::string(from_a.data(), 7), "request");
+    EXPECT_EQ(results[2], 5);
+    EXPECT_EQ(std::string(from_b.data(), 5), "ready");
+}
+
+TEST_F(SerialSubmitTest, WaitsOverlapAcrossHandles)
+{
+    // Two reads with 200 ms timeouts whose data arrives after 50 ms: both finish in one shared wait.
+    std::thread producer([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        (void)write(pipe_a[1], "a", 1);
+        (void)write(pipe_b[1], "b", 1);
+    });
+
+    std::array<char, 4> from_a{};
+    std::array<char, 4> from_b{};
+    const std::array<SerialOperation, 2> operations = {{
+        readOp(pipe_a[0], from_a.data(), static_cast<int>(from_a.size()), 200),
+        readOp(pipe_b[0], from_b.data(), static_cast<int>(from_b.size()), 200),
+    }};
+    std::array<int32_t, 2> results{};
+
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(serialSubmit(operations.data(), results.data(), 2, error_callback), 2);
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    producer.join();
+
+    EXPECT_EQ(results[0], 1);
+    EXPECT_EQ(results[1], 1);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(190));
+}
+
+TEST_F(SerialSubmitTest, TimeoutsArePerOperation)
+{
+    std::array<char, 4> buffer_a{};
+    std::array<char, 4> buffer_b{};
+    const std::array<SerialOperation, 2> operations = {{
+        readOp(pipe_a[0], buffer_a.data(), static_cast<int>(buffer_a.size()), 0),
+        readOp(pipe_b[0], buffer_b.data(), static_cast<int>(buffer_b.size()), 30),
+    }};
+    std::array<int32_t, 2> results = {-1, -1};
+
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(serialSubmit(operations.data(), results.data(), 2, error_callback), 2);
+    EXPECT_GE(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(29));
+    EXPECT_EQ(results[0], 0);
+    EXPECT_EQ(results[1], 0);
+}
+
+TEST_F(SerialSubmitTest, SameSideOperationsRunInOrder)
+{
+    ASSERT_EQ(write(pipe_a[1], "first", 5), 5);
+    std::thread producer([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        (void)write(pipe_a[1], "second", 6);
+    });
+
+    std::array<char, 16> one{};
+    std::array<char, 16> two{};
+    const std::array<SerialOperation, 2> operations = {{
+        readOp(pipe_a[0], one.data(), static_cast<int>(one.size()), 500),
+        readOp(pipe_a[0], two.data(), static_cast<int>(two.size()), 500),
+    }};
+    std::array<int32_t, 2> results{};
+
+    EXPECT_EQ(serialSubmit(operations.data(), results.data(), 2, error_callback), 2);
+    producer.join();
+    EXPECT_EQ(std::string(one.data(), static_cast<std::size_t>(results[0])), "first");
+    EXPECT_EQ(std::string(two.data(), static_cast<std::size_t>(results[1])), "second");
+}
+
+TEST_F(SerialSubmitTest, FailedOperationDoesNotStopTheBatch)
+{
+    ASSERT_EQ(write(pipe_b[1], "ok", 2), 2);
+
+    std::array<char, 4> buffer_a{};
+    std::array<char, 4> buffer_b{};
+    const std::array<SerialOperation, 2> operations = {{
+        readOp(pipe_a[1], buffer_a.data(), static_cast<int>(buffer_a.size()), 0), // reading a write end fails
+        readOp(pipe_b[0], buffer_b.data(), static_cast<int>(buffer_b.size()), 100),
+    }};
+    std::array<int32_t, 2> results{};
+
+    EXPECT_EQ(serialSubmit(operations.data(), results.data(), 2, error_callback), 1);
+    EXPECT_EQ(results[0], static_cast<int32_t>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(results[1], 2);
+    EXPECT_EQ(error_capture.call_count, 1);
+}
+
+TEST_F(SerialSubmitTest, RequestResponseOnOnePort)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    std::thread device([&pty] {
+        std::array<char, 16> request{};
+        for (int i = 0; i < 200; ++i)
+        {
+            if (read(pty.master_fd, request.data(), request.size()) > 0)
+            {
+                (void)write(pty.master_fd, "OK\r\n", 4);
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    std::array<char, 16> response{};
+    const std::array<SerialOperation, 2> operations = {{
+        {handle, kSerialOperationWrite, 3, const_cast<char *>("AT\r"), 100, 0},
+        {handle, kSerialOperationRead, static_cast<int32_t>(response.size()), response.data(), 500, 0},
+    }};
+    std::array<int32_t, 2> results{};
+
+    EXPECT_EQ(serialSubmit(operations.data(), results.data(), 2, error_callback), 2);
+    device.join();
+    EXPECT_EQ(results[0], 3);
+    EXPECT_EQ(results[1], 4);
+
+    SerialPortStats stats{};
+    ASSERT_EQ(serialGetStats(handle, &stats, nullptr), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+    EXPECT_EQ(stats.tx_bytes, 3U);
+    EXPECT_EQ(stats.rx_bytes, 4U);
+
+    serialClose(handle, nullptr);
+}
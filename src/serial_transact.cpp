@@ -0,0 +1,281 @@
+#include <cpp_bindings_linux/interface/serial_transact.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <limits>
+#include <mutex>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace
+{
+auto validate(const SerialTransaction &transaction) -> const char *
+{
+    if (transaction.request_size < 0 || (transaction.request_size > 0 && transaction.request == nullptr))
+    {
+        return "Invalid request or request_size";
+    }
+    if (transaction.reply == nullptr || transaction.reply_capacity <= 0)
+    {
+        return "Invalid reply or reply_capacity";
+    }
+    if (transaction.reply_length < 0 || transaction.reply_length > transaction.reply_capacity)
+    {
+        return "Invalid reply_length: must be 0 .. reply_capacity";
+    }
+    if (transaction.delimiter < -1 || transaction.delimiter > 255)
+    {
+        return "Invalid delimiter: must be -1 .. 255";
+    }
+    if (transaction.inter_byte_timeout_ms < 0)
+    {
+        return "Invalid inter_byte_timeout_ms: must be >= 0";
+    }
+    return nullptr;
+}
+
+// Bytes the reply can still take before it is complete by length or capacity.
+auto replyRoom(const SerialTransaction &transaction) -> int
+{
+    const int limit = transaction.reply_length > 0 ? transaction.reply_length : transaction.reply_capacity;
+    return limit - transaction.reply_size;
+}
+
+// Appends one byte; returns true when it completes the reply.
+auto appendReplyByte(SerialTransaction &transaction, unsigned char byte) -> bool
+{
+    static_cast<unsigned char *>(transaction.reply)[transaction.reply_size++] = byte;
+    return replyRoom(transaction) == 0 || static_cast<int>(byte) == transaction.delimiter;
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialTransact(int64_t handle, SerialTransaction *transactions, int count, int pipeline_depth,
+                                   int flags, int timeout_ms, ErrorCallbackT error_callback) -> int
+    {
+        if (transactions == nullptr || count <= 0 || count > kSerialTransactMaxTransactions)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid transactions or count");
+        }
+        if (pipeline_depth <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid pipeline_depth: must be >= 1");
+        }
+        if ((flags & ~kSerialTransactFlushInput) != 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid flags");
+        }
+        for (int i = 0; i < count; ++i)
+        {
+            const char *message = validate(transactions[i]);
+            if (message != nullptr)
+            {
+                return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                                message);
+            }
+        }
+        if (handle <= 0 || handle > std::numeric_limits<int>::max())
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                            "Invalid handle");
+        }
+
+        const int fd = static_cast<int>(handle);
+        auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+        std::unique_lock<std::mutex> write_lock;
+        std::unique_lock<std::mutex> read_lock;
+        if (state != nullptr)
+        {
+            write_lock = std::unique_lock<std::mutex>(state->write.mutex, std::defer_lock);
+            read_lock = std::unique_lock<std::mutex>(state->read.mutex, std::defer_lock);
+            std::lock(write_lock, read_lock);
+        }
+        if (cpp_bindings_linux::detail::rejectCompressedWrite(state, error_callback))
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kWriteError);
+        }
+        if (cpp_bindings_linux::detail::rejectFanoutRead(state, error_callback) ||
+            cpp_bindings_linux::detail::rejectCompressedRead(state, error_callback))
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kReadError);
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            transactions[i].reply_size = 0;
+        }
+        if ((flags & kSerialTransactFlushInput) != 0)
+        {
+            cpp_bindings_linux::detail::dropCarried(state);
+            if (tcflush(fd, TCIFLUSH) != 0 && errno != ENOTTY)
+            {
+                return cpp_bindings_linux::detail::failErrno<int>(error_callback,
+                                                                  cpp_core::StatusCodes::kClearBufferInError);
+            }
+        }
+
+        const cpp_bindings_linux::detail::Deadline deadline(std::max(timeout_ms, 0));
+        int sending = 0;          // request being written
+        int sent_offset = 0;      // bytes of it already written
+        int receiving = 0;        // reply being collected
+        int64_t last_byte_ns = 0; // arrival of the latest byte of the current reply
+        int64_t total_written = 0;
+        int64_t total_read = 0;
+        int error_number = 0;
+        auto error_code = cpp_core::StatusCodes::kReadError;
+        std::array<unsigned char, cpp_bindings_linux::detail::ReadCarry::kCapacity> chunk{};
+
+        // A started reply that has been quiet for its inter-byte timeout is complete.
+        const auto gapEnds = [&](int64_t now_ns) {
+            const SerialTransaction &current = transactions[receiving];
+            return current.inter_byte_timeout_ms > 0 && current.reply_size > 0 &&
+                   now_ns - last_byte_ns >= static_cast<int64_t>(current.inter_byte_timeout_ms) * 1'000'000;
+        };
+
+        while (receiving < count && error_number == 0)
+        {
+            // Send ahead as far as the pipeline depth and the output queue allow.
+            while (sending < count && sending < receiving + pipeline_depth)
+            {
+                const SerialTransaction &request = transactions[sending];
+                if (sent_offset == request.request_size)
+                {
+                    ++sending;
+                    sent_offset = 0;
+                    continue;
+                }
+                const ssize_t bytes = ::write(fd, static_cast<const unsigned char *>(request.request) + sent_offset,
+                                              static_cast<size_t>(request.request_size - sent_offset));
+                if (bytes > 0)
+                {
+                    sent_offset += static_cast<int>(bytes);
+                    total_written += bytes;
+                    continue;
+                }
+                if (bytes < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    error_number = errno;
+                    error_code = cpp_core::StatusCodes::kWriteError;
+                }
+                break;
+            }
+            if (error_number != 0)
+            {
+                break;
+            }
+
+            const int64_t now_ns = cpp_bindings_linux::detail::monotonicNowNs();
+            if (gapEnds(now_ns))
+            {
+                ++receiving;
+                continue;
+            }
+
+            // Bytes kept by an earlier exchange were received before anything still queued, so they come first.
+            ssize_t bytes =
+                cpp_bindings_linux::detail::takeCarried(state, chunk.data(), static_cast<int>(chunk.size()));
+            int64_t received_ns = bytes > 0 ? state->read.carry.received_ns : 0;
+            if (bytes == 0)
+            {
+                const int remaining_ms = deadline.remainingMs();
+                if (remaining_ms == 0)
+                {
+                    break;
+                }
+
+                int wait_ms = remaining_ms;
+                const SerialTransaction &current = transactions[receiving];
+                if (current.inter_byte_timeout_ms > 0 && current.reply_size > 0)
+                {
+                    const int64_t gap_left_ns =
+                        last_byte_ns + (static_cast<int64_t>(current.inter_byte_timeout_ms) * 1'000'000) - now_ns;
+                    wait_ms = std::min(wait_ms, static_cast<int>((gap_left_ns + 999'999) / 1'000'000));
+                }
+                const bool want_write = sending < count && sending < receiving + pipeline_depth;
+                struct pollfd poll_fd = {fd, static_cast<short>(POLLIN | (want_write ? POLLOUT : 0)), 0};
+                const int poll_result = poll(&poll_fd, 1, wait_ms);
+                if (poll_result < 0)
+                {
+                    if (errno != EINTR)
+                    {
+                        error_number = errno;
+                    }
+                    continue;
+                }
+                if ((poll_fd.revents & POLLNVAL) != 0)
+                {
+                    error_number = EBADF;
+                    continue;
+                }
+                if ((poll_fd.revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+                {
+                    continue;
+                }
+
+                // A registered handle keeps what follows the last reply, so one read() takes everything queued.
+                // Other descriptors have nowhere to keep it: their reads stop at the end of the reply where its
+                // length tells, and the last delimited reply is read byte by byte.
+                int wanted = static_cast<int>(chunk.size());
+                if (state == nullptr)
+                {
+                    const bool delimited_last = receiving == count - 1 && current.delimiter >= 0;
+                    wanted = delimited_last ? 1 : std::min(replyRoom(current), wanted);
+                }
+                bytes = cpp_bindings_linux::detail::readAfterReady(fd, chunk.data(), wanted);
+                if (bytes < 0)
+                {
+                    error_number = errno;
+                    continue;
+                }
+            }
+            if (bytes > 0)
+            {
+                // Kept bytes count as arriving now for the inter-byte timeout, like bytes that waited in the kernel
+                // queue.
+                last_byte_ns = cpp_bindings_linux::detail::monotonicNowNs();
+                received_ns = received_ns != 0 ? received_ns : last_byte_ns;
+                total_read += bytes;
+            }
+            ssize_t used = 0;
+            while (used < bytes && receiving < count)
+            {
+                if (appendReplyByte(transactions[receiving], chunk[static_cast<std::size_t>(used++)]))
+                {
+                    ++receiving;
+                }
+            }
+            if (used < bytes && state != nullptr)
+            {
+                // Counted in the statistics once a read hands them out.
+                cpp_bindings_linux::detail::keepCarried(*state, chunk.data() + used, static_cast<int>(bytes - used),
+                                                        received_ns);
+                total_read -= bytes - used;
+            }
+        }
+
+        cpp_bindings_linux::detail::recordWrite(state, total_written);
+        cpp_bindings_linux::detail::recordRead(state, total_read);
+        if (error_number != 0)
+        {
+            errno = error_number;
+            return cpp_bindings_linux::detail::failErrno<int>(
+                error_callback, error_number == EBADF ? cpp_core::StatusCodes::kInvalidHandleError : error_code);
+        }
+        return receiving;
+    }
+
+} // extern "C"
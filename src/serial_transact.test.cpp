@@ -0,0 +1,280 @@
+#include <cpp_bindings_linux/interface/serial_transact.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/virtual_device.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Answers every "<command>\n" line with "OK <command>\r\n", however the lines are split into chunks.
+auto lineResponder() -> VirtualDevice::Responder
+{
+    auto pending = std::make_shared<std::string>();
+    return [pending](std::string_view received) {
+        pending->append(received);
+        std::string reply;
+        for (auto end = pending->find('\n'); end != std::string::npos; end = pending->find('\n'))
+        {
+            reply += "OK " + pending->substr(0, end) + "\r\n";
+            pending->erase(0, end + 1);
+        }
+        return reply;
+    };
+}
+
+auto lineTransaction(const std::string &request, std::array<char, 64> &reply) -> SerialTransaction
+{
+    SerialTransaction transaction{};
+    transaction.request = request.data();
+    transaction.request_size = static_cast<int32_t>(request.size());
+    transaction.reply = reply.data();
+    transaction.reply_capacity = static_cast<int32_t>(reply.size());
+    transaction.delimiter = '\n';
+    return transaction;
+}
+
+auto replyText(const SerialTransaction &transaction) -> std::string
+{
+    return {static_cast<const char *>(transaction.reply), static_cast<std::size_t>(transaction.reply_size)};
+}
+} // namespace
+
+class SerialTransactTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+    }
+
+    auto start(VirtualDeviceOptions options, VirtualDevice::Responder responder) -> bool
+    {
+        device = std::make_unique<VirtualDevice>(options, std::move(responder));
+        if (!device->valid())
+        {
+            return false;
+        }
+        handle = device->openHost();
+        return handle > 0;
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+        device.reset();
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    std::unique_ptr<VirtualDevice> device;
+    int64_t handle = 0;
+};
+
+TEST_F(SerialTransactTest, InvalidArguments)
+{
+    if (!start({}, lineResponder()))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const std::string request = "PING\n";
+    std::array<char, 64> reply{};
+    SerialTransaction transaction = lineTransaction(request, reply);
+
+    EXPECT_EQ(serialTransact(handle, nullptr, 1, 1, 0, 100, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialTransact(handle, &transaction, 0, 1, 0, 100, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialTransact(handle, &transaction, 1, 0, 0, 100, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialTransact(handle, &transaction, 1, 1, 0x80, 100, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialTransact(-1, &transaction, 1, 1, 0, 100, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+
+    transaction.delimiter = 256;
+    EXPECT_EQ(serialTransact(handle, &transaction, 1, 1, 0, 100, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    transaction.delimiter = '\n';
+    transaction.reply_length = static_cast<int32_t>(reply.size()) + 1;
+    EXPECT_EQ(serialTransact(handle, &transaction, 1, 1, 0, 100, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialTransactTest, DelimitedReply)
+{
+    if (!start({}, lineResponder()))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const std::string request = "PING\n";
+    std::array<char, 64> reply{};
+    SerialTransaction transaction = lineTransaction(request, reply);
+
+    ASSERT_EQ(serialTransact(handle, &transaction, 1, 1, 0, 1000, error_callback), 1);
+    EXPECT_EQ(replyText(transaction), "OK PING\r\n");
+}
+
+TEST_F(SerialTransactTest, PipelinedRepliesMatchRequestsInOrder)
+{
+    VirtualDeviceOptions options;
+    options.latency = std::chrono::milliseconds(40);
+    if (!start(options, lineResponder()))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    const std::vector<std::string> requests = {"A\n", "B\n", "C\n", "D\n"};
+    std::vector<std::array<char, 64>> replies(requests.size());
+    std::vector<SerialTransaction> transactions;
+    for (std::size_t i = 0; i < requests.size(); ++i)
+    {
+        transactions.push_back(lineTransaction(requests[i], replies[i]));
+    }
+
+    // One request at a time costs a device latency each; pipelined they overlap.
+    const auto start_time = Clock::now();
+    ASSERT_EQ(serialTransact(handle, transactions.data(), static_cast<int>(transactions.size()), 4, 0, 2000,
+                             error_callback),
+              4);
+    EXPECT_LT(Clock::now() - start_time, std::chrono::milliseconds(4 * 40));
+    EXPECT_EQ(replyText(transactions[0]), "OK A\r\n");
+    EXPECT_EQ(replyText(transactions[1]), "OK B\r\n");
+    EXPECT_EQ(replyText(transactions[2]), "OK C\r\n");
+    EXPECT_EQ(replyText(transactions[3]), "OK D\r\n");
+
+    ASSERT_EQ(serialTransact(handle, transactions.data(), static_cast<int>(transactions.size()), 1, 0, 2000,
+                             error_callback),
+              4);
+    EXPECT_EQ(replyText(transactions[3]), "OK D\r\n");
+}
+
+TEST_F(SerialTransactTest, FlushInputDropsStaleBytes)
+{
+    if (!start({}, lineResponder()))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    device->send("STALE\r\n");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    const std::string request = "PING\n";
+    std::array<char, 64> reply{};
+    SerialTransaction transaction = lineTransaction(request, reply);
+    ASSERT_EQ(serialTransact(handle, &transaction, 1, 1, kSerialTransactFlushInput, 1000, error_callback), 1);
+    EXPECT_EQ(replyText(transaction), "OK PING\r\n");
+}
+
+TEST_F(SerialTransactTest, BytesAfterTheLastDelimitedReplyStayForTheNextRead)
+{
+    // Answers once per request line, even when the device reads the line in pieces.
+    const auto answer = [](std::string_view received) {
+        return received.find('\n') != std::string_view::npos ? std::string("OK\r\nEVENT 7\r\n") : std::string();
+    };
+    if (!start({}, answer))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const std::string request = "Q\n";
+    std::array<char, 64> reply{};
+    SerialTransaction transaction = lineTransaction(request, reply);
+    ASSERT_EQ(serialTransact(handle, &transaction, 1, 1, 0, 1000, error_callback), 1);
+    EXPECT_EQ(replyText(transaction), "OK\r\n");
+
+    std::string unsolicited;
+    std::array<char, 64> buffer{};
+    while (unsolicited.size() < 9)
+    {
+        const int bytes = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, error_callback);
+        ASSERT_GT(bytes, 0);
+        unsolicited.append(buffer.data(), static_cast<std::size_t>(bytes));
+    }
+    EXPECT_EQ(unsolicited, "EVENT 7\r\n");
+}
+
+TEST_F(SerialTransactTest, BytesAfterPipelinedRepliesInOneBurstAreKept)
+{
+    // Both replies and an unsolicited line arrive together, so one read() returns all of them.
+    auto pending = std::make_shared<std::string>();
+    const auto burst = [pending](std::string_view received) {
+        pending->append(received);
+        return pending->size() == 4 ? std::string("A\r\nB\r\nEVENT\r\n") : std::string();
+    };
+    if (!start({}, burst))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const std::string request_a = "A\n";
+    const std::string request_b = "B\n";
+    std::array<char, 64> reply_a{};
+    std::array<char, 64> reply_b{};
+    std::array<SerialTransaction, 2> transactions = {lineTransaction(request_a, reply_a),
+                                                     lineTransaction(request_b, reply_b)};
+    ASSERT_EQ(serialTransact(handle, transactions.data(), 2, 2, 0, 1000, error_callback), 2);
+    EXPECT_EQ(replyText(transactions[0]), "A\r\n");
+    EXPECT_EQ(replyText(transactions[1]), "B\r\n");
+
+    std::string unsolicited;
+    std::array<char, 64> buffer{};
+    while (unsolicited.size() < 7)
+    {
+        const int bytes = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, error_callback);
+        ASSERT_GT(bytes, 0);
+        unsolicited.append(buffer.data(), static_cast<std::size_t>(bytes));
+    }
+    EXPECT_EQ(unsolicited, "EVENT\r\n");
+}
+
+TEST_F(SerialTransactTest, LengthAndInterByteTimeout)
+{
+    if (!start({}, [](std::string_view) { return std::string("12345"); }))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const std::string request = "Q";
+    std::array<char, 64> reply{};
+
+    // Fixed length: complete after 3 bytes; the rest stays for the next transaction.
+    SerialTransaction fixed = {request.data(), reply.data(), 1, static_cast<int32_t>(reply.size()), 3, -1, 0, 0};
+    ASSERT_EQ(serialTransact(handle, &fixed, 1, 1, 0, 1000, error_callback), 1);
+    EXPECT_EQ(replyText(fixed), "123");
+
+    // No terminator at all: the pause after the last byte ends the reply, long before the deadline.
+    SerialTransaction gap = {nullptr, reply.data(), 0, static_cast<int32_t>(reply.size()), 0, -1, 20, 0};
+    const auto start_time = Clock::now();
+    ASSERT_EQ(serialTransact(handle, &gap, 1, 1, 0, 2000, error_callback), 1);
+    EXPECT_LT(Clock::now() - start_time, std::chrono::milliseconds(500));
+    EXPECT_EQ(replyText(gap), "45");
+}
+
+TEST_F(SerialTransactTest, TimeoutReportsIncompleteReply)
+{
+    if (!start({}, [](std::string_view) { return std::string("partial"); }))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const std::string request = "Q";
+    std::array<char, 64> reply{};
+    SerialTransaction transaction = lineTransaction(request, reply);
+
+    EXPECT_EQ(serialTransact(handle, &transaction, 1, 1, 0, 100, error_callback), 0);
+    EXPECT_EQ(replyText(transaction), "partial");
+}
@@ -1,69 +1,70 @@
+#include <cpp_bindings_linux/interface/serial_timeout_ns.h>
+#include <cpp_bindings_linux/serial_port.hpp>
 #include <cpp_core/interface/serial_write.h>
 #include <cpp_core/status_codes.h>
 
+#include "detail/link_compression.hpp"
+#include "detail/port_registry.hpp"
 #include "detail/posix_helpers.hpp"
 
-#include <cerrno>
-#include <fcntl.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <limits>
-#include <termios.h>
-#include <unistd.h>
 
-extern "C"
+namespace
+{
+// serialWrite() and serialWriteNs() differ only in the unit of their timeout.
+auto writePort(int64_t handle, const void *buffer, int buffer_size, std::chrono::nanoseconds timeout,
+               ErrorCallbackT error_callback) -> int
 {
+    if (buffer == nullptr || buffer_size <= 0)
+    {
+        return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                        "Invalid buffer or buffer_size");
+    }
 
-    MODULE_API auto serialWrite(int64_t handle, const void *buffer, int buffer_size, int timeout_ms, int /*multiplier*/,
-                                ErrorCallbackT error_callback) -> int
+    if (handle <= 0 || handle > std::numeric_limits<int>::max())
     {
-        if (buffer == nullptr || buffer_size <= 0)
-        {
-            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
-                                                            "Invalid buffer or buffer_size");
-        }
+        return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                        "Invalid handle");
+    }
 
-        if (handle <= 0 || handle > std::numeric_limits<int>::max())
-        {
-            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
-                                                            "Invalid handle");
-        }
+    const int fd = static_cast<int>(handle);
 
-        if (timeout_ms < 0)
-        {
-            timeout_ms = 0;
-        }
+    auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+    const auto side_lock = cpp_bindings_linux::detail::lockWriteSide(state);
 
-        const int fd = static_cast<int>(handle);
+    const auto result =
+        state != nullptr && state->write.compression != nullptr
+            ? cpp_bindings_linux::detail::compressedWrite(fd, *state->write.compression,
+                                                          static_cast<const unsigned char *>(buffer), buffer_size,
+                                                          cpp_bindings_linux::detail::toTimeoutNs(timeout))
+            : cpp_bindings_linux::SerialPortView(fd).write(
+                  {static_cast<const std::byte *>(buffer), static_cast<std::size_t>(buffer_size)}, timeout);
+    if (!result)
+    {
+        return cpp_bindings_linux::detail::failError<int>(error_callback, result.error());
+    }
+    cpp_bindings_linux::detail::recordWrite(state, static_cast<int64_t>(*result));
 
-        ssize_t bytes_written = ::write(fd, buffer, buffer_size);
-        if (bytes_written < 0)
-        {
-            if (errno == EAGAIN || errno == EWOULDBLOCK)
-            {
-                const int ready = cpp_bindings_linux::detail::waitFdReady(fd, timeout_ms, false);
-                if (ready < 0)
-                {
-                    return cpp_bindings_linux::detail::failErrno<int>(error_callback,
-                                                                      cpp_core::StatusCodes::kWriteError);
-                }
-                if (ready > 0)
-                {
-                    bytes_written = ::write(fd, buffer, buffer_size);
-                }
-                else
-                {
-                    return 0;
-                }
-            }
+    return static_cast<int>(*result);
+}
+} // namespace
 
-            if (bytes_written < 0)
-            {
-                return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kWriteError);
-            }
-        }
+extern "C"
+{
 
-        tcdrain(fd);
+    MODULE_API auto serialWrite(int64_t handle, const void *buffer, int buffer_size, int timeout_ms, int /*multiplier*/,
+                                ErrorCallbackT error_callback) -> int
+    {
+        return writePort(handle, buffer, buffer_size, std::chrono::milliseconds(timeout_ms), error_callback);
+    }
 
-        return static_cast<int>(bytes_written);
+    MODULE_API auto serialWriteNs(int64_t handle, const void *buffer, int buffer_size, int64_t timeout_ns,
+                                  ErrorCallbackT error_callback) -> int
+    {
+        return writePort(handle, buffer, buffer_size, std::chrono::nanoseconds(timeout_ns), error_callback);
     }
 
 } // extern "C"
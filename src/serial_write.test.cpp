@@ -1,3 +1,4 @@
+#include <cpp_bindings_linux/interface/serial_timeout_ns.h>
 #include <cpp_core/interface/serial_write.h>
 #include <cpp_core/status_codes.h>
 
@@ -164,3 +165,18 @@ TEST_F(SerialWriteTest, WriteEmptyStringToDevNull)
     EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
     close(fd);
 }
+
+TEST_F(SerialWriteTest, WriteNsToDevNull)
+{
+    int fd = open("/dev/null", O_WRONLY | O_NONBLOCK);
+    ASSERT_GE(fd, 0);
+
+    const char *test_data = "Hello World";
+    const int len = static_cast<int>(strlen(test_data));
+    EXPECT_EQ(serialWriteNs(fd, test_data, len, 250'000, error_callback), len);
+    EXPECT_EQ(serialWriteNs(fd, nullptr, len, 250'000, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialWriteNs(0, test_data, len, 250'000, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    close(fd);
+}
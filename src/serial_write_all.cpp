@@ -0,0 +1,88 @@
+#include <cpp_bindings_linux/interface/serial_write_all.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/link_compression.hpp"
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+
+#include <cerrno>
+#include <limits>
+#include <unistd.h>
+
+extern "C"
+{
+    MODULE_API auto serialWriteAll(int64_t handle, const void *buffer, int buffer_size, int timeout_ms,
+                                   int /*multiplier*/, ErrorCallbackT error_callback) -> int
+    {
+        if (buffer == nullptr || buffer_size <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer or buffer_size");
+        }
+
+        if (handle <= 0 || handle > std::numeric_limits<int>::max())
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kInvalidHandleError,
+                                                            "Invalid handle");
+        }
+
+        if (timeout_ms < 0)
+        {
+            timeout_ms = 0;
+        }
+
+        const int fd = static_cast<int>(handle);
+        const auto *buf = static_cast<const unsigned char *>(buffer);
+        const cpp_bindings_linux::detail::Deadline deadline(timeout_ms);
+
+        auto *state = cpp_bindings_linux::detail::PortRegistry::instance().find(fd);
+        const auto side_lock = cpp_bindings_linux::detail::lockWriteSide(state);
+
+        if (state != nullptr && state->write.compression != nullptr)
+        {
+            // compressedWrite() already keeps going until everything is sent or the deadline passes.
+            const auto result = cpp_bindings_linux::detail::compressedWrite(
+                fd, *state->write.compression, buf, buffer_size, deadline.remainingNs());
+            if (!result)
+            {
+                return cpp_bindings_linux::detail::failError<int>(error_callback, result.error());
+            }
+            cpp_bindings_linux::detail::recordWrite(state, static_cast<int64_t>(*result));
+            return static_cast<int>(*result);
+        }
+
+        int total_written = 0;
+        while (total_written < buffer_size)
+        {
+            const ssize_t bytes_written = ::write(fd, buf + total_written, buffer_size - total_written);
+            if (bytes_written > 0)
+            {
+                total_written += static_cast<int>(bytes_written);
+                continue;
+            }
+            if (bytes_written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (bytes_written < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kWriteError);
+            }
+
+            // Output queue is full: sleep until the driver has room again, but never past the overall deadline.
+            const int ready = cpp_bindings_linux::detail::waitFdReady(fd, deadline.remainingMs(), false);
+            if (ready < 0)
+            {
+                return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kWriteError);
+            }
+            if (ready == 0)
+            {
+                break;
+            }
+        }
+
+        cpp_bindings_linux::detail::recordWrite(state, total_written);
+        return total_written;
+    }
+
+} // extern "C"
@@ -0,0 +1,114 @@
+#include <cpp_bindings_linux/interface/serial_write_all.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <fcntl.h>
+#include <limits>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+
+class SerialWriteAllTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        ASSERT_EQ(pipe(pipefd.data()), 0);
+        fcntl(pipefd[0], F_SETFL, O_NONBLOCK);
+        fcntl(pipefd[1], F_SETFL, O_NONBLOCK);
+        // Small kernel buffer, so bulk writes are forced through many partial writes.
+        pipe_capacity = fcntl(pipefd[1], F_SETPIPE_SZ, 4096);
+        ASSERT_GT(pipe_capacity, 0);
+    }
+
+    void TearDown() override
+    {
+        close(pipefd[0]);
+        close(pipefd[1]);
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    std::array<int, 2> pipefd{};
+    int pipe_capacity = 0;
+};
+
+TEST_F(SerialWriteAllTest, NullBuffer)
+{
+    int result = serialWriteAll(pipefd[1], nullptr, 10, 100, 0, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+}
+
+TEST_F(SerialWriteAllTest, InvalidHandle)
+{
+    int result = serialWriteAll(-1, "test", 4, 100, 0, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
+
+TEST_F(SerialWriteAllTest, InvalidHandleTooLarge)
+{
+    auto too_large = static_cast<int64_t>(std::numeric_limits<int>::max()) + 1;
+    int result = serialWriteAll(too_large, "test", 4, 100, 0, error_callback);
+
+    EXPECT_EQ(result, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+}
+
+TEST_F(SerialWriteAllTest, SmallWriteCompletesImmediately)
+{
+    int result = serialWriteAll(pipefd[1], "test", 4, 0, 0, error_callback);
+
+    EXPECT_EQ(result, 4);
+}
+
+TEST_F(SerialWriteAllTest, BulkWriteLoopsOverPartialWrites)
+{
+    const std::string payload(pipe_capacity * 16, 'x');
+
+    std::string received;
+    std::thread reader([&] {
+        std::array<char, 1024> chunk{};
+        while (received.size() < payload.size())
+        {
+            const ssize_t bytes = read(pipefd[0], chunk.data(), chunk.size());
+            if (bytes > 0)
+            {
+                received.append(chunk.data(), static_cast<size_t>(bytes));
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+    });
+
+    int result = serialWriteAll(pipefd[1], payload.data(), static_cast<int>(payload.size()), 5000, 0, error_callback);
+    reader.join();
+
+    EXPECT_EQ(result, static_cast<int>(payload.size()));
+    EXPECT_EQ(received, payload);
+}
+
+TEST_F(SerialWriteAllTest, TimeoutReportsBytesAccepted)
+{
+    const std::string payload(pipe_capacity * 4, 'y');
+
+    const auto start = std::chrono::steady_clock::now();
+    int result = serialWriteAll(pipefd[1], payload.data(), static_cast<int>(payload.size()), 50, 0, error_callback);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Nobody drains the pipe: exactly its capacity is accepted, then the single deadline expires.
+    EXPECT_EQ(result, pipe_capacity);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(45));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+}
@@ -0,0 +1,236 @@
+#include <cpp_bindings_linux/interface/serial_write_pacing.h>
+#include <cpp_core/status_codes.h>
+
+#include "detail/port_registry.hpp"
+#include "detail/posix_helpers.hpp"
+#include "detail/write_pacer.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace
+{
+constexpr int kMaxQueueCapacity = 16 * 1024 * 1024;
+
+auto laneOf(cpp_bindings_linux::detail::PacedQueue &queue, int lane) -> cpp_bindings_linux::detail::PacedLane &
+{
+    return lane == kSerialWriteLaneUrgent ? queue.urgent : queue.bulk;
+}
+
+// Queues one frame into a lane, waiting for room up to timeout_ms. Bulk frames are queued piecewise as room
+// frees up; urgent frames only as a whole.
+auto queueFrame(int64_t handle, const void *buffer, int buffer_size, int lane, int timeout_ms,
+                ErrorCallbackT error_callback) -> int
+{
+    auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+    if (state == nullptr)
+    {
+        return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+    }
+
+    const cpp_bindings_linux::detail::Deadline deadline(std::max(timeout_ms, 0));
+    const auto *data = static_cast<const unsigned char *>(buffer);
+    const auto size = static_cast<std::size_t>(buffer_size);
+    const bool whole = lane == kSerialWriteLaneUrgent;
+    std::size_t queued = 0;
+    const cpp_bindings_linux::detail::PacedQueue *frame_queue = nullptr; // queue holding our open frame, if any
+    std::unique_lock<std::mutex> lock(state->write.mutex);
+    while (true)
+    {
+        auto *queue = state->write.pacing.get();
+        if (queue == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kWriteError,
+                                                            "Write pacing is not enabled");
+        }
+        if (queue->error_number != 0)
+        {
+            errno = std::exchange(queue->error_number, 0);
+            return cpp_bindings_linux::detail::failErrno<int>(error_callback, cpp_core::StatusCodes::kWriteError);
+        }
+
+        auto &target = laneOf(*queue, lane);
+        std::size_t pushed = 0;
+        if (!whole || (target.freeSpace() >= size && target.freeFrames() > 0 && !target.frame_open))
+        {
+            pushed = target.push(data + queued, size - queued, queue == frame_queue,
+                                 cpp_bindings_linux::detail::monotonicNowNs());
+        }
+        queued += pushed;
+        if (pushed > 0)
+        {
+            frame_queue = queue;
+            cpp_bindings_linux::detail::WritePacer::instance().wake();
+        }
+        const int remaining_ms = deadline.remainingMs();
+        if (queued == size || remaining_ms == 0)
+        {
+            break;
+        }
+        queue->space.wait_for(lock, std::chrono::milliseconds(remaining_ms));
+    }
+    if (auto *queue = state->write.pacing.get(); queue != nullptr && queue == frame_queue)
+    {
+        laneOf(*queue, lane).closeFrame(cpp_bindings_linux::detail::monotonicNowNs());
+        queue->space.notify_all(); // writers waiting for the frame to close
+    }
+    cpp_bindings_linux::detail::recordWrite(state, static_cast<int64_t>(queued));
+    return static_cast<int>(queued);
+}
+} // namespace
+
+extern "C"
+{
+    MODULE_API auto serialSetWritePacing(int64_t handle, int max_queued_ms, int queue_capacity,
+                                         ErrorCallbackT error_callback) -> int
+    {
+        if (max_queued_ms < 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid max_queued_ms: must be >= 0");
+        }
+        if (max_queued_ms > 0 && (queue_capacity <= 0 || queue_capacity > kMaxQueueCapacity))
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid queue_capacity: must be 1 .. 16 MiB");
+        }
+
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+        const int fd = static_cast<int>(handle);
+        auto &pacer = cpp_bindings_linux::detail::WritePacer::instance();
+
+        // Built outside the lock; the swap waits for an in-flight write to finish.
+        auto queue = max_queued_ms > 0 ? std::make_unique<cpp_bindings_linux::detail::PacedQueue>(
+                                             max_queued_ms, static_cast<std::size_t>(queue_capacity),
+                                             static_cast<std::size_t>(kSerialUrgentFrameMax))
+                                       : nullptr;
+        {
+            const std::scoped_lock write_lock(state->write.mutex);
+            if (queue != nullptr && state->write.compression != nullptr)
+            {
+                // The pacer hands raw bytes to the port; see serialSetCompression().
+                return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kSetStateError,
+                                                                "Handle is in compressed-stream mode");
+            }
+            state->write.pacing.swap(queue);
+            if (queue != nullptr)
+            {
+                queue->space.notify_all(); // writers waiting on the old queue re-check and find it gone
+            }
+        }
+
+        if (max_queued_ms == 0)
+        {
+            if (state->paced.exchange(false))
+            {
+                pacer.remove(fd);
+            }
+            return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+        }
+        if (!state->paced.exchange(true))
+        {
+            const auto added = pacer.add(fd);
+            if (!added)
+            {
+                state->paced.store(false);
+                const std::scoped_lock write_lock(state->write.mutex);
+                state->write.pacing.reset();
+                return cpp_bindings_linux::detail::failError<int>(error_callback, added.error());
+            }
+        }
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialWritePaced(int64_t handle, const void *buffer, int buffer_size, int timeout_ms,
+                                     ErrorCallbackT error_callback) -> int
+    {
+        if (buffer == nullptr || buffer_size <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer or buffer_size");
+        }
+
+        return queueFrame(handle, buffer, buffer_size, kSerialWriteLaneBulk, timeout_ms, error_callback);
+    }
+
+    MODULE_API auto serialWritePriority(int64_t handle, const void *buffer, int buffer_size, int lane, int timeout_ms,
+                                        ErrorCallbackT error_callback) -> int
+    {
+        if (buffer == nullptr || buffer_size <= 0)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid buffer or buffer_size");
+        }
+        if (lane != kSerialWriteLaneBulk && lane != kSerialWriteLaneUrgent)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid lane");
+        }
+        if (lane == kSerialWriteLaneUrgent && buffer_size > kSerialUrgentFrameMax)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Urgent frame exceeds kSerialUrgentFrameMax");
+        }
+        return queueFrame(handle, buffer, buffer_size, lane, timeout_ms, error_callback);
+    }
+
+    MODULE_API auto serialGetWriteLaneStats(int64_t handle, int lane, SerialWriteLaneStats *stats,
+                                            ErrorCallbackT error_callback) -> int
+    {
+        if (stats == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "stats is nullptr");
+        }
+        if (lane != kSerialWriteLaneBulk && lane != kSerialWriteLaneUrgent)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kBufferError,
+                                                            "Invalid lane");
+        }
+
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        *stats = SerialWriteLaneStats{};
+        const std::scoped_lock write_lock(state->write.mutex);
+        if (state->write.pacing == nullptr)
+        {
+            return cpp_bindings_linux::detail::failMsg<int>(error_callback, cpp_core::StatusCodes::kWriteError,
+                                                            "Write pacing is not enabled");
+        }
+        const auto &source = laneOf(*state->write.pacing, lane);
+        stats->frames_sent = source.stats.frames_sent;
+        stats->bytes_sent = source.stats.bytes_sent;
+        stats->total_delay_ns = source.stats.total_delay_ns;
+        stats->max_delay_ns = source.stats.max_delay_ns;
+        stats->last_delay_ns = source.stats.last_delay_ns;
+        stats->queued_frames = static_cast<uint32_t>(source.frame_count);
+        stats->queued_bytes = static_cast<uint32_t>(source.size);
+        return static_cast<int>(cpp_core::StatusCodes::kSuccess);
+    }
+
+    MODULE_API auto serialPacedQueueDepth(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        auto *state = cpp_bindings_linux::detail::findRegisteredPort(handle, error_callback);
+        if (state == nullptr)
+        {
+            return static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError);
+        }
+
+        const std::scoped_lock write_lock(state->write.mutex);
+        const auto *queue = state->write.pacing.get();
+        return queue != nullptr ? static_cast<int>(queue->bulk.size + queue->urgent.size) : 0;
+    }
+
+} // extern "C"
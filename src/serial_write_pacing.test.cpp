@@ -0,0 +1,229 @@
+#include <cpp_bindings_linux/interface/serial_write_pacing.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/error_capture.hpp"
+#include "test_helpers/virtual_device.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Polls the device until it has received needle, or timeout_ms passed. Returns the wait in milliseconds, or -1.
+auto waitReceived(const VirtualDevice &device, const std::string &needle, int timeout_ms) -> int64_t
+{
+    const auto start = Clock::now();
+    while (Clock::now() - start < std::chrono::milliseconds(timeout_ms))
+    {
+        if (device.received().find(needle) != std::string::npos)
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return -1;
+}
+} // namespace
+
+class SerialWritePacingTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ErrorCapture::instance = &error_capture;
+        error_callback = &ErrorCapture::callback;
+
+        device = std::make_unique<VirtualDevice>(VirtualDeviceOptions{}, VirtualDevice::Responder{});
+        if (!device->valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        handle = device->openHost();
+        ASSERT_GT(handle, 0);
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+        device.reset();
+        ErrorCapture::instance = nullptr;
+    }
+
+    ErrorCapture error_capture;
+    ErrorCallbackT error_callback = nullptr;
+    std::unique_ptr<VirtualDevice> device;
+    int64_t handle = 0;
+};
+
+TEST_F(SerialWritePacingTest, InvalidArguments)
+{
+    const std::array<char, 4> data{'a', 'b', 'c', 'd'};
+    EXPECT_EQ(serialSetWritePacing(-1, 10, 1024, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialSetWritePacing(handle, -1, 1024, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialSetWritePacing(handle, 10, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialWritePaced(handle, nullptr, 4, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialPacedQueueDepth(0, error_callback), static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(serialWritePriority(handle, data.data(), 4, 2, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    const std::string oversized(kSerialUrgentFrameMax + 1, 'u');
+    EXPECT_EQ(serialWritePriority(handle, oversized.data(), static_cast<int>(oversized.size()),
+                                  kSerialWriteLaneUrgent, 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(serialGetWriteLaneStats(handle, kSerialWriteLaneBulk, nullptr, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kBufferError));
+
+    // Not enabled yet.
+    EXPECT_EQ(serialWritePaced(handle, data.data(), static_cast<int>(data.size()), 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kWriteError));
+    EXPECT_EQ(serialPacedQueueDepth(handle, error_callback), 0);
+    SerialWriteLaneStats stats{};
+    EXPECT_EQ(serialGetWriteLaneStats(handle, kSerialWriteLaneUrgent, &stats, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kWriteError));
+}
+
+TEST_F(SerialWritePacingTest, UrgentWriteOvertakesPacedBulk)
+{
+    // ~520 ms of wire time at 115200 baud; the kernel never holds more than 20 ms of it.
+    std::string bulk(6000, 'x');
+    for (std::size_t i = 0; i < bulk.size(); ++i)
+    {
+        bulk[i] = static_cast<char>('a' + (i % 26));
+    }
+    ASSERT_EQ(serialSetWritePacing(handle, 20, 8192, error_callback), 0);
+
+    const auto start = Clock::now();
+    ASSERT_EQ(serialWritePaced(handle, bulk.data(), static_cast<int>(bulk.size()), 1000, error_callback),
+              static_cast<int>(bulk.size()));
+    EXPECT_LT(Clock::now() - start, std::chrono::milliseconds(100)) << "queueing must not wait for the wire";
+    EXPECT_GT(serialPacedQueueDepth(handle, error_callback), 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const std::string urgent = "URGENT";
+    ASSERT_EQ(serialWrite(handle, urgent.data(), static_cast<int>(urgent.size()), 1000, 0, error_callback),
+              static_cast<int>(urgent.size()));
+
+    // Unpaced, the command would sit behind ~470 ms of bulk data.
+    const int64_t urgent_ms = waitReceived(*device, urgent, 1000);
+    ASSERT_GE(urgent_ms, 0);
+    EXPECT_LT(urgent_ms, 150);
+
+    // The bulk data still arrives completely and in order.
+    const auto deadline = Clock::now() + std::chrono::seconds(3);
+    while (device->received().size() < bulk.size() + urgent.size() && Clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    std::string received = device->received();
+    ASSERT_NE(received.find(urgent), std::string::npos);
+    received.erase(received.find(urgent), urgent.size());
+    EXPECT_EQ(received, bulk);
+    EXPECT_EQ(serialPacedQueueDepth(handle, error_callback), 0);
+
+    EXPECT_EQ(serialSetWritePacing(handle, 0, 0, error_callback), 0);
+    EXPECT_EQ(serialWritePaced(handle, urgent.data(), static_cast<int>(urgent.size()), 0, error_callback),
+              static_cast<int>(cpp_core::StatusCodes::kWriteError));
+}
+
+TEST_F(SerialWritePacingTest, FullQueueTimesOutWithPartialCount)
+{
+    const std::string bulk(4096, 'p');
+    ASSERT_EQ(serialSetWritePacing(handle, 10, 1024, error_callback), 0);
+
+    // 1 KiB buffer, ~1 KiB/90 ms at the wire: within 20 ms only part of 4 KiB fits.
+    const int queued = serialWritePaced(handle, bulk.data(), static_cast<int>(bulk.size()), 20, error_callback);
+    EXPECT_GE(queued, 1024);
+    EXPECT_LT(queued, static_cast<int>(bulk.size()));
+}
+
+TEST_F(SerialWritePacingTest, UrgentLaneGoesOutAtTheNextFrameBoundary)
+{
+    // 60 bulk frames of 100 bytes, ~520 ms of wire time in total.
+    constexpr std::size_t kFrameSize = 100;
+    std::string bulk;
+    ASSERT_EQ(serialSetWritePacing(handle, 20, 8192, error_callback), 0);
+    for (int i = 0; i < 60; ++i)
+    {
+        std::string frame = "<frame " + std::to_string(i) + ">";
+        frame.resize(kFrameSize, static_cast<char>('a' + (i % 26)));
+        ASSERT_EQ(serialWritePaced(handle, frame.data(), static_cast<int>(frame.size()), 1000, error_callback),
+                  static_cast<int>(frame.size()));
+        bulk += frame;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const std::string urgent = "EMERGENCY-STOP";
+    ASSERT_EQ(serialWritePriority(handle, urgent.data(), static_cast<int>(urgent.size()), kSerialWriteLaneUrgent,
+                                  1000, error_callback),
+              static_cast<int>(urgent.size()));
+    const int64_t urgent_ms = waitReceived(*device, urgent, 1000);
+    ASSERT_GE(urgent_ms, 0);
+    EXPECT_LT(urgent_ms, 150);
+
+    const auto deadline = Clock::now() + std::chrono::seconds(3);
+    while (device->received().size() < bulk.size() + urgent.size() && Clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    std::string received = device->received();
+    const std::size_t position = received.find(urgent);
+    ASSERT_NE(position, std::string::npos);
+    EXPECT_EQ(position % kFrameSize, 0U) << "the urgent frame must not split a bulk frame";
+    EXPECT_GT(position, 0U);
+    EXPECT_LT(position, bulk.size());
+    received.erase(position, urgent.size());
+    EXPECT_EQ(received, bulk);
+
+    SerialWriteLaneStats urgent_stats{};
+    SerialWriteLaneStats bulk_stats{};
+    ASSERT_EQ(serialGetWriteLaneStats(handle, kSerialWriteLaneUrgent, &urgent_stats, error_callback), 0);
+    ASSERT_EQ(serialGetWriteLaneStats(handle, kSerialWriteLaneBulk, &bulk_stats, error_callback), 0);
+    EXPECT_EQ(urgent_stats.frames_sent, 1U);
+    EXPECT_EQ(urgent_stats.bytes_sent, urgent.size());
+    EXPECT_EQ(urgent_stats.max_delay_ns, urgent_stats.total_delay_ns);
+    EXPECT_LT(urgent_stats.max_delay_ns, 150'000'000);
+    EXPECT_EQ(bulk_stats.frames_sent, 60U);
+    EXPECT_EQ(bulk_stats.bytes_sent, bulk.size());
+    EXPECT_EQ(bulk_stats.queued_frames, 0U);
+    EXPECT_EQ(bulk_stats.queued_bytes, 0U);
+    // The last bulk frame waited for nearly all the others to go out.
+    EXPECT_GT(bulk_stats.max_delay_ns, 300'000'000);
+    EXPECT_GT(bulk_stats.max_delay_ns, urgent_stats.max_delay_ns);
+}
+
+TEST_F(SerialWritePacingTest, UrgentLaneWaitsForTheBulkFrameOnTheWire)
+{
+    // One bulk frame of ~260 ms wire time: the urgent frame may not cut into it.
+    const std::string bulk(3000, 'b');
+    ASSERT_EQ(serialSetWritePacing(handle, 20, 8192, error_callback), 0);
+    ASSERT_EQ(serialWritePaced(handle, bulk.data(), static_cast<int>(bulk.size()), 1000, error_callback),
+              static_cast<int>(bulk.size()));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+    const std::string urgent = "PING";
+    ASSERT_EQ(serialWritePriority(handle, urgent.data(), static_cast<int>(urgent.size()), kSerialWriteLaneUrgent,
+                                  1000, error_callback),
+              static_cast<int>(urgent.size()));
+    ASSERT_GE(waitReceived(*device, urgent, 2000), 0);
+    EXPECT_EQ(device->received(), bulk + urgent);
+
+    SerialWriteLaneStats stats{};
+    ASSERT_EQ(serialGetWriteLaneStats(handle, kSerialWriteLaneUrgent, &stats, error_callback), 0);
+    EXPECT_EQ(stats.frames_sent, 1U);
+    EXPECT_GT(stats.last_delay_ns, 100'000'000);
+}
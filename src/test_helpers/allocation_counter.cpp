@@ -0,0 +1,74 @@
+#include "test_helpers/allocation_counter.hpp"
+
+#include <cstddef>
+
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define ALLOCATION_COUNTER_SUPPORTED 0
+#else
+#define ALLOCATION_COUNTER_SUPPORTED 1
+#endif
+
+namespace
+{
+thread_local int *active_count = nullptr;
+
+#if ALLOCATION_COUNTER_SUPPORTED
+auto countAllocation() -> void
+{
+    if (active_count != nullptr)
+    {
+        ++*active_count;
+    }
+}
+#endif
+} // namespace
+
+AllocationCounter::AllocationCounter() : previous_(active_count)
+{
+    active_count = &count_;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    active_count = previous_;
+}
+
+auto AllocationCounter::supported() -> bool
+{
+    return ALLOCATION_COUNTER_SUPPORTED != 0;
+}
+
+#if ALLOCATION_COUNTER_SUPPORTED
+extern "C"
+{
+    // glibc's own entry points; the allocator is the same, so free() stays the plain libc one.
+    auto __libc_malloc(size_t size) -> void *;
+    auto __libc_calloc(size_t count, size_t size) -> void *;
+    auto __libc_realloc(void *pointer, size_t size) -> void *;
+    auto __libc_memalign(size_t alignment, size_t size) -> void *;
+
+    auto malloc(size_t size) noexcept -> void *
+    {
+        countAllocation();
+        return __libc_malloc(size);
+    }
+
+    auto calloc(size_t count, size_t size) noexcept -> void *
+    {
+        countAllocation();
+        return __libc_calloc(count, size);
+    }
+
+    auto realloc(void *pointer, size_t size) noexcept -> void *
+    {
+        countAllocation();
+        return __libc_realloc(pointer, size);
+    }
+
+    auto aligned_alloc(size_t alignment, size_t size) noexcept -> void *
+    {
+        countAllocation();
+        return __libc_memalign(alignment, size);
+    }
+} // extern "C"
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+// Counts heap allocations made on the current thread while an AllocationCounter is alive.
+//
+// The test executable defines malloc/calloc/realloc/aligned_alloc itself and forwards to glibc's __libc_*
+// implementations. operator new (and with it every std::string, std::vector and std::function) allocates through
+// malloc, and the library is a shared object whose calls resolve to these definitions first, so the count covers
+// everything one public entry point allocates. Sanitizer runtimes replace malloc themselves; under them the
+// counter is unsupported and tests skip.
+class AllocationCounter
+{
+  public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter &) = delete;
+    auto operator=(const AllocationCounter &) -> AllocationCounter & = delete;
+
+    [[nodiscard]] static auto supported() -> bool;
+
+    [[nodiscard]] auto count() const -> int
+    {
+        return count_;
+    }
+
+  private:
+    int count_ = 0;
+    int *previous_;
+};
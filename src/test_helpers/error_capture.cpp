@@ -6,6 +6,7 @@ void ErrorCapture::callback(int code, const char *message)
     {
         instance->last_code = code;
         instance->last_message = message != nullptr ? message : "";
+        ++instance->call_count;
     }
 }
 
@@ -9,6 +9,7 @@ struct ErrorCapture
 {
     int last_code = 0;
     std::string last_message;
+    int call_count = 0;
 
     static void callback(int code, const char *message);
 
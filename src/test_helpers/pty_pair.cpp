@@ -0,0 +1,71 @@
+#include "test_helpers/pty_pair.hpp"
+
+#include <cpp_core/interface/serial_open.h>
+
+#include "detail/port_registry.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <memory>
+#include <sys/ioctl.h>
+#include <thread>
+#include <unistd.h>
+
+PtyPair::PtyPair()
+{
+    master_fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (master_fd < 0)
+    {
+        return;
+    }
+    std::array<char, 128> name{};
+    if (grantpt(master_fd) != 0 || unlockpt(master_fd) != 0 || ptsname_r(master_fd, name.data(), name.size()) != 0)
+    {
+        close(master_fd);
+        master_fd = -1;
+        return;
+    }
+    slave_path = name.data();
+}
+
+PtyPair::~PtyPair()
+{
+    if (master_fd >= 0)
+    {
+        close(master_fd);
+    }
+}
+
+auto PtyPair::openSlave(int baudrate) const -> int64_t
+{
+    return serialOpen(const_cast<char *>(slave_path.c_str()), baudrate, 8, 0, 1, nullptr);
+}
+
+auto PtyPair::waitQueued(int64_t handle, int min_bytes, int timeout_ms) -> bool
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        int queued = 0;
+        if (ioctl(static_cast<int>(handle), FIONREAD, &queued) == 0 && queued >= min_bytes)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+RegisteredMaster::RegisteredMaster(int fd, int baudrate) : fd_(fd)
+{
+    cpp_bindings_linux::detail::PortRegistry::instance().add(
+        fd, std::make_unique<cpp_bindings_linux::detail::PortState>(
+                cpp_bindings_linux::detail::PortConfig{"pty master", baudrate}));
+}
+
+RegisteredMaster::~RegisteredMaster()
+{
+    cpp_bindings_linux::detail::PortRegistry::instance().remove(fd_);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Pseudo-terminal pair for tests that need a real tty instead of a pipe.
+// The slave side is meant to be opened through serialOpen(); the test drives the master side directly.
+struct PtyPair
+{
+    PtyPair();
+    ~PtyPair();
+
+    PtyPair(const PtyPair &) = delete;
+    auto operator=(const PtyPair &) -> PtyPair & = delete;
+
+    [[nodiscard]] auto valid() const -> bool
+    {
+        return master_fd >= 0 && !slave_path.empty();
+    }
+
+    // Opens the slave side with serialOpen() (raw 8N1). Returns the handle, or a negative status code.
+    [[nodiscard]] auto openSlave(int baudrate = 115200) const -> int64_t;
+
+    // Blocks until the slave handle has at least min_bytes queued (data written to the master is delivered
+    // asynchronously by the kernel). Returns false after timeout_ms.
+    static auto waitQueued(int64_t handle, int min_bytes, int timeout_ms = 1000) -> bool;
+
+    int master_fd = -1;
+    std::string slave_path;
+};
+
+// Gives a descriptor that was not opened with serialOpen() (usually PtyPair::master_fd) per-port state for as long
+// as it lives, so the test can run library modes such as compressed-stream mode on the device end of the pty too.
+class RegisteredMaster
+{
+  public:
+    explicit RegisteredMaster(int fd, int baudrate = 115200);
+    ~RegisteredMaster();
+
+    RegisteredMaster(const RegisteredMaster &) = delete;
+    auto operator=(const RegisteredMaster &) -> RegisteredMaster & = delete;
+
+  private:
+    int fd_;
+};
@@ -0,0 +1,179 @@
+// Interposed libc wrappers must be plain functions, not the fortified inline versions.
+#undef _FORTIFY_SOURCE
+
+#include "test_helpers/syscall_counter.hpp"
+
+#include <csignal>
+#include <cstdarg>
+#include <cstddef>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace
+{
+thread_local SyscallCounts *active_counts = nullptr;
+
+template <typename Fn>
+auto nextSymbol(const char *name) -> Fn
+{
+    return reinterpret_cast<Fn>(dlsym(RTLD_NEXT, name));
+}
+
+auto count(int SyscallCounts::*field, Syscall kind) -> void
+{
+    if (active_counts != nullptr)
+    {
+        ++(active_counts->*field);
+        if (active_counts->sequence_length < SyscallCounts::kMaxSequence)
+        {
+            active_counts->sequence[static_cast<std::size_t>(active_counts->sequence_length)] = kind;
+        }
+        ++active_counts->sequence_length;
+    }
+}
+
+// open() takes a mode only with O_CREAT or O_TMPFILE; reading it unconditionally is harmless on Linux ABIs.
+auto openMode(va_list args) -> mode_t
+{
+    return static_cast<mode_t>(va_arg(args, int));
+}
+} // namespace
+
+SyscallCounter::SyscallCounter() : previous_(active_counts)
+{
+    active_counts = &counts_;
+}
+
+SyscallCounter::~SyscallCounter()
+{
+    active_counts = previous_;
+}
+
+extern "C"
+{
+    auto open(const char *path, int flags, ...) -> int
+    {
+        static const auto real = nextSymbol<int (*)(const char *, int, ...)>("open");
+        va_list args;
+        va_start(args, flags);
+        const mode_t mode = openMode(args);
+        va_end(args);
+        count(&SyscallCounts::open, Syscall::kOpen);
+        return real(path, flags, mode);
+    }
+
+    auto open64(const char *path, int flags, ...) -> int
+    {
+        static const auto real = nextSymbol<int (*)(const char *, int, ...)>("open64");
+        va_list args;
+        va_start(args, flags);
+        const mode_t mode = openMode(args);
+        va_end(args);
+        count(&SyscallCounts::open, Syscall::kOpen);
+        return real(path, flags, mode);
+    }
+
+    auto __open_2(const char *path, int flags) -> int
+    {
+        static const auto real = nextSymbol<int (*)(const char *, int)>("__open_2");
+        count(&SyscallCounts::open, Syscall::kOpen);
+        return real(path, flags);
+    }
+
+    auto __open64_2(const char *path, int flags) -> int
+    {
+        static const auto real = nextSymbol<int (*)(const char *, int)>("__open64_2");
+        count(&SyscallCounts::open, Syscall::kOpen);
+        return real(path, flags);
+    }
+
+    auto close(int fd) -> int
+    {
+        static const auto real = nextSymbol<int (*)(int)>("close");
+        count(&SyscallCounts::close, Syscall::kClose);
+        return real(fd);
+    }
+
+    auto poll(struct pollfd *fds, nfds_t nfds, int timeout) -> int
+    {
+        static const auto real = nextSymbol<int (*)(struct pollfd *, nfds_t, int)>("poll");
+        count(&SyscallCounts::poll, Syscall::kPoll);
+        return real(fds, nfds, timeout);
+    }
+
+    auto __poll_chk(struct pollfd *fds, nfds_t nfds, int timeout, size_t fdslen) -> int
+    {
+        static const auto real = nextSymbol<int (*)(struct pollfd *, nfds_t, int, size_t)>("__poll_chk");
+        count(&SyscallCounts::poll, Syscall::kPoll);
+        return real(fds, nfds, timeout, fdslen);
+    }
+
+    // Read waits use ppoll() (read_loop.hpp); it is the same wait as poll(), so it counts as poll.
+    auto ppoll(struct pollfd *fds, nfds_t nfds, const struct timespec *timeout, const sigset_t *sigmask) -> int
+    {
+        static const auto real =
+            nextSymbol<int (*)(struct pollfd *, nfds_t, const struct timespec *, const sigset_t *)>("ppoll");
+        count(&SyscallCounts::poll, Syscall::kPoll);
+        return real(fds, nfds, timeout, sigmask);
+    }
+
+    auto __ppoll_chk(struct pollfd *fds, nfds_t nfds, const struct timespec *timeout, const sigset_t *sigmask,
+                     size_t fdslen) -> int
+    {
+        static const auto real =
+            nextSymbol<int (*)(struct pollfd *, nfds_t, const struct timespec *, const sigset_t *, size_t)>(
+                "__ppoll_chk");
+        count(&SyscallCounts::poll, Syscall::kPoll);
+        return real(fds, nfds, timeout, sigmask, fdslen);
+    }
+
+    auto read(int fd, void *buf, size_t count_bytes) -> ssize_t
+    {
+        static const auto real = nextSymbol<ssize_t (*)(int, void *, size_t)>("read");
+        count(&SyscallCounts::read, Syscall::kRead);
+        return real(fd, buf, count_bytes);
+    }
+
+    auto __read_chk(int fd, void *buf, size_t nbytes, size_t buflen) -> ssize_t
+    {
+        static const auto real = nextSymbol<ssize_t (*)(int, void *, size_t, size_t)>("__read_chk");
+        count(&SyscallCounts::read, Syscall::kRead);
+        return real(fd, buf, nbytes, buflen);
+    }
+
+    auto write(int fd, const void *buf, size_t count_bytes) -> ssize_t
+    {
+        static const auto real = nextSymbol<ssize_t (*)(int, const void *, size_t)>("write");
+        count(&SyscallCounts::write, Syscall::kWrite);
+        return real(fd, buf, count_bytes);
+    }
+
+    auto ioctl(int fd, unsigned long request, ...) noexcept -> int
+    {
+        static const auto real = nextSymbol<int (*)(int, unsigned long, void *)>("ioctl");
+        va_list args;
+        va_start(args, request);
+        void *argument = va_arg(args, void *);
+        va_end(args);
+        count(&SyscallCounts::ioctl, Syscall::kIoctl);
+        return real(fd, request, argument);
+    }
+
+    auto tcdrain(int fd) -> int
+    {
+        static const auto real = nextSymbol<int (*)(int)>("tcdrain");
+        count(&SyscallCounts::tcdrain, Syscall::kTcdrain);
+        return real(fd);
+    }
+
+    auto tcflush(int fd, int queue_selector) noexcept -> int
+    {
+        static const auto real = nextSymbol<int (*)(int, int)>("tcflush");
+        count(&SyscallCounts::tcflush, Syscall::kTcflush);
+        return real(fd, queue_selector);
+    }
+} // extern "C"
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <string>
+
+// Counts the libc syscall wrappers the library calls while a SyscallCounter is alive on the current thread.
+//
+// The test executable defines open/close/poll/ppoll/read/write/ioctl/tcdrain/tcflush itself and forwards to libc
+// through dlsym(RTLD_NEXT). Because the library is linked as a shared object, its calls resolve to these
+// definitions first, so the counts reflect exactly what one public entry point costs in syscalls. tcdrain() and
+// tcflush() are ioctls underneath, but glibc issues those directly, so they are counted under their own names.
+enum class Syscall : char
+{
+    kOpen = 'o',
+    kClose = 'c',
+    kPoll = 'p',
+    kRead = 'r',
+    kWrite = 'w',
+    kIoctl = 'i',
+    kTcdrain = 'd',
+    kTcflush = 'f',
+};
+
+struct SyscallCounts
+{
+    int open = 0;
+    int close = 0;
+    int poll = 0; // poll() and ppoll()
+    int read = 0;
+    int write = 0;
+    int ioctl = 0;
+    int tcdrain = 0;
+    int tcflush = 0;
+
+    // The calls in order, one letter each (see Syscall); only the first kMaxSequence are kept.
+    static constexpr int kMaxSequence = 64;
+    std::array<Syscall, kMaxSequence> sequence{};
+    int sequence_length = 0;
+
+    [[nodiscard]] auto total() const -> int
+    {
+        return open + close + poll + read + write + ioctl + tcdrain + tcflush;
+    }
+
+    // e.g. "wd" for one write() followed by tcdrain().
+    [[nodiscard]] auto trace() const -> std::string
+    {
+        std::string text;
+        for (int i = 0; i < sequence_length && i < kMaxSequence; ++i)
+        {
+            text += static_cast<char>(sequence[static_cast<std::size_t>(i)]);
+        }
+        return text;
+    }
+};
+
+class SyscallCounter
+{
+  public:
+    SyscallCounter();
+    ~SyscallCounter();
+
+    SyscallCounter(const SyscallCounter &) = delete;
+    auto operator=(const SyscallCounter &) -> SyscallCounter & = delete;
+
+    [[nodiscard]] auto counts() const -> const SyscallCounts &
+    {
+        return counts_;
+    }
+
+  private:
+    SyscallCounts counts_;
+    SyscallCounts *previous_;
+};
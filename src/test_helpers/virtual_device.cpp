@@ -0,0 +1,232 @@
+#include "test_helpers/virtual_device.hpp"
+
+#include <cpp_core/interface/serial_open.h>
+
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <poll.h>
+#include <unistd.h>
+
+namespace
+{
+auto nowNs() -> int64_t
+{
+    struct timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<int64_t>(now.tv_sec) * 1'000'000'000) + now.tv_nsec;
+}
+
+// How long the device thread sleeps at most between pacing steps.
+constexpr int kTickMs = 1;
+} // namespace
+
+VirtualDevice::VirtualDevice(VirtualDeviceOptions options, Responder responder)
+    : options_(options), responder_(std::move(responder)),
+      ns_per_byte_((static_cast<int64_t>(options.bits_per_character) * 1'000'000'000) / options.baudrate),
+      rng_state_(options.seed == 0 ? 1 : options.seed)
+{
+    if (!pty_.valid())
+    {
+        return;
+    }
+    rx_next_ns_ = nowNs();
+    tx_next_ns_ = rx_next_ns_;
+    thread_ = std::thread([this] { run(); });
+}
+
+VirtualDevice::~VirtualDevice()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+auto VirtualDevice::echo() -> Responder
+{
+    return [](std::string_view received) { return std::string(received); };
+}
+
+auto VirtualDevice::openHost() const -> int64_t
+{
+    return pty_.openSlave(options_.baudrate);
+}
+
+auto VirtualDevice::send(std::string_view bytes) -> void
+{
+    const std::scoped_lock lock(mutex_);
+    outgoing_.push_back({std::string(bytes), 0});
+}
+
+auto VirtualDevice::hangup() -> void
+{
+    if (!thread_.joinable())
+    {
+        return;
+    }
+    hangup_requested_.store(true);
+    // Wait for the device thread to close its end, so the host observes the hangup once this returns.
+    while (!stop_.load() && hangup_requested_.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kTickMs));
+    }
+}
+
+auto VirtualDevice::received() const -> std::string
+{
+    const std::scoped_lock lock(mutex_);
+    return received_;
+}
+
+auto VirtualDevice::characterTime() const -> std::chrono::nanoseconds
+{
+    return std::chrono::nanoseconds(ns_per_byte_);
+}
+
+auto VirtualDevice::run() -> void
+{
+    while (!stop_.load())
+    {
+        if (hangup_requested_.load())
+        {
+            close(pty_.master_fd);
+            pty_.master_fd = -1;
+            hangup_requested_.store(false);
+            return;
+        }
+
+        struct pollfd poll_fd = {pty_.master_fd, POLLIN, 0};
+        poll(&poll_fd, 1, kTickMs);
+
+        if ((poll_fd.revents & (POLLIN | POLLHUP)) == POLLHUP)
+        {
+            // No host has the slave open (yet, or any more); the master reports a hangup until one does.
+            std::this_thread::sleep_for(std::chrono::milliseconds(kTickMs));
+        }
+
+        const int64_t now_ns = nowNs();
+        if ((poll_fd.revents & POLLIN) != 0)
+        {
+            receiveFromHost(now_ns);
+        }
+        sendToHost(now_ns);
+    }
+}
+
+auto VirtualDevice::receiveFromHost(int64_t now_ns) -> void
+{
+    // The device cannot take bytes faster than the line delivers them, so a fast host writer eventually finds the
+    // pty buffer full, just as with a real UART.
+    rx_next_ns_ = std::max(rx_next_ns_, now_ns - (ns_per_byte_ * 64));
+    const int64_t credit = ((now_ns - rx_next_ns_) / std::max<int64_t>(ns_per_byte_, 1)) + 1;
+
+    std::array<char, 4096> buffer{};
+    const auto wanted = static_cast<std::size_t>(std::clamp<int64_t>(credit, 1, buffer.size()));
+    const ssize_t bytes = read(pty_.master_fd, buffer.data(), wanted);
+    if (bytes <= 0)
+    {
+        return;
+    }
+    rx_next_ns_ += bytes * ns_per_byte_;
+
+    const std::string_view chunk(buffer.data(), static_cast<std::size_t>(bytes));
+    std::string reply = responder_ ? responder_(chunk) : std::string();
+
+    const std::scoped_lock lock(mutex_);
+    received_.append(chunk);
+    if (!reply.empty())
+    {
+        outgoing_.push_back({std::move(reply), now_ns + (static_cast<int64_t>(options_.latency.count()) * 1000)});
+    }
+}
+
+auto VirtualDevice::sendToHost(int64_t now_ns) -> void
+{
+    std::string wire;
+    {
+        const std::scoped_lock lock(mutex_);
+        std::size_t pending_bytes = 0;
+        for (const auto &entry : outgoing_)
+        {
+            if (entry.not_before_ns > now_ns)
+            {
+                break;
+            }
+            pending_bytes += entry.bytes.size();
+        }
+        if (pending_bytes == 0)
+        {
+            // An idle line does not bank credit for later.
+            tx_next_ns_ = std::max(tx_next_ns_, now_ns);
+            return;
+        }
+
+        auto allowed = static_cast<std::size_t>(
+            std::max<int64_t>((now_ns - tx_next_ns_) / std::max<int64_t>(ns_per_byte_, 1), 0));
+        if (options_.burst_bytes > 0)
+        {
+            // Hold bytes back until a whole burst (or the rest of the queue) has had its wire time.
+            const auto burst_size = static_cast<std::size_t>(options_.burst_bytes);
+            if (allowed >= burst_size)
+            {
+                allowed = (allowed / burst_size) * burst_size;
+            }
+            else if (allowed < pending_bytes)
+            {
+                allowed = 0;
+            }
+        }
+
+        while (allowed > 0 && !outgoing_.empty() && outgoing_.front().not_before_ns <= now_ns)
+        {
+            auto &front = outgoing_.front();
+            const std::size_t take = std::min(allowed, front.bytes.size());
+            wire.append(front.bytes, 0, take);
+            front.bytes.erase(0, take);
+            allowed -= take;
+            if (front.bytes.empty())
+            {
+                outgoing_.pop_front();
+            }
+        }
+    }
+
+    if (wire.empty())
+    {
+        return;
+    }
+    tx_next_ns_ += static_cast<int64_t>(wire.size()) * ns_per_byte_;
+
+    std::string delivered;
+    delivered.reserve(wire.size());
+    for (const char byte : wire)
+    {
+        // xorshift64: deterministic per seed, cheap enough to run per byte.
+        rng_state_ ^= rng_state_ << 13;
+        rng_state_ ^= rng_state_ >> 7;
+        rng_state_ ^= rng_state_ << 17;
+        const double sample = static_cast<double>(rng_state_ >> 11) / static_cast<double>(1ULL << 53);
+        if (sample < options_.drop_probability)
+        {
+            bytes_dropped_.fetch_add(1);
+            continue;
+        }
+        delivered.push_back(byte);
+    }
+
+    std::size_t offset = 0;
+    while (offset < delivered.size() && !stop_.load())
+    {
+        const ssize_t bytes = write(pty_.master_fd, delivered.data() + offset, delivered.size() - offset);
+        if (bytes > 0)
+        {
+            offset += static_cast<std::size_t>(bytes);
+            continue;
+        }
+        struct pollfd poll_fd = {pty_.master_fd, POLLOUT, 0};
+        poll(&poll_fd, 1, kTickMs);
+    }
+    bytes_sent_.fetch_add(offset);
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "test_helpers/pty_pair.hpp"
+
+// Line behaviour of a VirtualDevice. Defaults model a perfect 115200 8N1 link.
+struct VirtualDeviceOptions
+{
+    int baudrate = 115200;
+    int bits_per_character = 10; // start + 8 data + stop
+
+    // Extra delay before each reply produced by the responder leaves the device.
+    std::chrono::microseconds latency{0};
+
+    // Probability that a device-to-host byte is lost on the wire (deterministic for a given seed).
+    double drop_probability = 0.0;
+    uint32_t seed = 1;
+
+    // When > 0, device-to-host bytes leave in bursts of this size (as a USB-serial adapter flushing its FIFO)
+    // instead of one character time apart. A burst never leaves earlier than the wire time of its bytes.
+    int burst_bytes = 0;
+};
+
+// Scripted serial device on the far end of a pseudo-terminal.
+//
+// A background thread plays the device: it drains what the host writes at the configured baud rate, hands each
+// received chunk to the responder, and sends replies (or bytes queued with send()) back paced at the wire speed,
+// with the configured latency, drops and bursts applied. The host side is opened with openHost(), exactly like a
+// real port, so timeouts and throughput can be measured without hardware.
+class VirtualDevice
+{
+  public:
+    // Returns the bytes the device replies with for one chunk received from the host (empty for no reply).
+    using Responder = std::function<std::string(std::string_view received)>;
+
+    explicit VirtualDevice(VirtualDeviceOptions options = {}, Responder responder = {});
+    ~VirtualDevice();
+
+    VirtualDevice(const VirtualDevice &) = delete;
+    auto operator=(const VirtualDevice &) -> VirtualDevice & = delete;
+
+    // Replies with every byte it receives.
+    static auto echo() -> Responder;
+
+    [[nodiscard]] auto valid() const -> bool
+    {
+        return pty_.valid();
+    }
+
+    // Opens the host side with serialOpen() at the device baud rate. Returns the handle or a negative status.
+    [[nodiscard]] auto openHost() const -> int64_t;
+
+    // Queues unsolicited device-to-host bytes (subject to the same pacing and faults as replies).
+    auto send(std::string_view bytes) -> void;
+
+    // Closes the device end: the host then sees a hangup, as when a USB adapter is unplugged.
+    auto hangup() -> void;
+
+    // Everything the device has received from the host so far.
+    [[nodiscard]] auto received() const -> std::string;
+
+    [[nodiscard]] auto bytesSent() const -> uint64_t
+    {
+        return bytes_sent_.load();
+    }
+    [[nodiscard]] auto bytesDropped() const -> uint64_t
+    {
+        return bytes_dropped_.load();
+    }
+
+    // Wire time of one character at the configured baud rate.
+    [[nodiscard]] auto characterTime() const -> std::chrono::nanoseconds;
+
+  private:
+    struct Pending
+    {
+        std::string bytes;
+        int64_t not_before_ns;
+    };
+
+    auto run() -> void;
+    auto receiveFromHost(int64_t now_ns) -> void;
+    auto sendToHost(int64_t now_ns) -> void;
+
+    VirtualDeviceOptions options_;
+    Responder responder_;
+    PtyPair pty_;
+    int64_t ns_per_byte_;
+
+    mutable std::mutex mutex_;
+    std::deque<Pending> outgoing_;
+    std::string received_;
+
+    int64_t rx_next_ns_ = 0;
+    int64_t tx_next_ns_ = 0;
+    uint64_t rng_state_;
+
+    std::atomic<uint64_t> bytes_sent_{0};
+    std::atomic<uint64_t> bytes_dropped_{0};
+    std::atomic<bool> hangup_requested_{false};
+    std::atomic<bool> stop_{false};
+    std::thread thread_;
+};
@@ -0,0 +1,189 @@
+// Stress test for the per-handle concurrency model: one thread reads and another writes the same handle while a
+// third polls its statistics. Build with the "tsan" preset to have ThreadSanitizer check the library for races.
+
+#include <cpp_bindings_linux/interface/serial_stats.h>
+#include <cpp_bindings_linux/interface/serial_write_all.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <poll.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+constexpr int kTotalBytes = 256 * 1024;
+constexpr int kChunkSize = 1000;
+
+auto patternByte(int index) -> unsigned char
+{
+    return static_cast<unsigned char>((index * 7) % 251);
+}
+
+// Far end of the pty: sends every byte it receives straight back.
+auto runEcho(int master_fd, const std::atomic<bool> &stop) -> void
+{
+    std::array<unsigned char, 4096> buffer{};
+    while (!stop.load())
+    {
+        struct pollfd poll_fd = {master_fd, POLLIN, 0};
+        if (poll(&poll_fd, 1, 10) <= 0)
+        {
+            continue;
+        }
+        const ssize_t received = read(master_fd, buffer.data(), buffer.size());
+        ssize_t sent = 0;
+        while (received > 0 && sent < received && !stop.load())
+        {
+            const ssize_t bytes = write(master_fd, buffer.data() + sent, static_cast<size_t>(received - sent));
+            if (bytes > 0)
+            {
+                sent += bytes;
+                continue;
+            }
+            struct pollfd out_fd = {master_fd, POLLOUT, 0};
+            poll(&out_fd, 1, 10);
+        }
+    }
+}
+} // namespace
+
+TEST(SerialFullDuplexTest, ConcurrentReadAndWriteOnOneHandle)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    std::atomic<bool> stop{false};
+    std::thread echo(runEcho, pty.master_fd, std::cref(stop));
+
+    std::atomic<int> write_failures{0};
+    std::thread writer([&] {
+        std::array<unsigned char, kChunkSize> chunk{};
+        for (int offset = 0; offset < kTotalBytes; offset += kChunkSize)
+        {
+            const int size = std::min(kChunkSize, kTotalBytes - offset);
+            for (int i = 0; i < size; ++i)
+            {
+                chunk[static_cast<size_t>(i)] = patternByte(offset + i);
+            }
+            if (serialWriteAll(handle, chunk.data(), size, 5000, 0, nullptr) != size)
+            {
+                write_failures.fetch_add(1);
+                return;
+            }
+        }
+    });
+
+    std::vector<unsigned char> received;
+    received.reserve(kTotalBytes);
+    std::thread reader([&] {
+        std::array<unsigned char, 2048> buffer{};
+        int idle_rounds = 0;
+        while (static_cast<int>(received.size()) < kTotalBytes && idle_rounds < 500)
+        {
+            const int bytes = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 10, 0, nullptr);
+            if (bytes < 0)
+            {
+                return;
+            }
+            idle_rounds = bytes == 0 ? idle_rounds + 1 : 0;
+            received.insert(received.end(), buffer.begin(), buffer.begin() + bytes);
+        }
+    });
+
+    std::atomic<bool> traffic_done{false};
+    std::thread observer([&] {
+        SerialPortStats stats{};
+        while (!traffic_done.load())
+        {
+            EXPECT_EQ(serialGetStats(handle, &stats, nullptr), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+            std::this_thread::yield();
+        }
+    });
+
+    writer.join();
+    reader.join();
+    traffic_done.store(true);
+    observer.join();
+    stop.store(true);
+    echo.join();
+
+    EXPECT_EQ(write_failures.load(), 0);
+    ASSERT_EQ(static_cast<int>(received.size()), kTotalBytes);
+    for (int i = 0; i < kTotalBytes; ++i)
+    {
+        ASSERT_EQ(received[static_cast<size_t>(i)], patternByte(i)) << "Mismatch at byte " << i;
+    }
+
+    SerialPortStats stats{};
+    ASSERT_EQ(serialGetStats(handle, &stats, nullptr), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+    EXPECT_EQ(stats.tx_bytes, static_cast<uint64_t>(kTotalBytes));
+    EXPECT_EQ(stats.rx_bytes, static_cast<uint64_t>(kTotalBytes));
+
+    EXPECT_EQ(serialClose(handle, nullptr), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+}
+
+TEST(SerialFullDuplexTest, SameSideCallsAreSerialized)
+{
+    PtyPair pty;
+    if (!pty.valid())
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+    const int64_t handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    // Several writers on one handle: every call must be accounted for exactly once.
+    constexpr int kWriters = 4;
+    constexpr int kWritesPerThread = 200;
+    std::atomic<bool> stop{false};
+    std::thread drain([&] {
+        std::array<unsigned char, 4096> buffer{};
+        while (!stop.load())
+        {
+            if (read(pty.master_fd, buffer.data(), buffer.size()) <= 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    writers.reserve(kWriters);
+    for (int t = 0; t < kWriters; ++t)
+    {
+        writers.emplace_back([&] {
+            for (int i = 0; i < kWritesPerThread; ++i)
+            {
+                serialWriteAll(handle, "0123456789", 10, 1000, 0, nullptr);
+            }
+        });
+    }
+    for (auto &writer : writers)
+    {
+        writer.join();
+    }
+    stop.store(true);
+    drain.join();
+
+    SerialPortStats stats{};
+    ASSERT_EQ(serialGetStats(handle, &stats, nullptr), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+    EXPECT_EQ(stats.write_calls, static_cast<uint64_t>(kWriters * kWritesPerThread));
+    EXPECT_EQ(stats.tx_bytes, static_cast<uint64_t>(kWriters * kWritesPerThread * 10));
+
+    EXPECT_EQ(serialClose(handle, nullptr), static_cast<int>(cpp_core::StatusCodes::kSuccess));
+}
@@ -0,0 +1,212 @@
+// Syscall budgets of the core entry points on a pty pair. Each test records the exact sequence of syscall
+// wrappers one call makes (see SyscallCounts::trace() for the letters) and asserts it, so an optimization shows up
+// as a change here and a regression fails. Update a budget only together with the change that justifies it.
+
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_open.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <cerrno>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/pty_pair.hpp"
+#include "test_helpers/syscall_counter.hpp"
+
+class SyscallBudgetTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+    }
+
+    auto openMeasured() -> SyscallCounts
+    {
+        const SyscallCounter counter;
+        handle = pty.openSlave();
+        return counter.counts();
+    }
+
+    PtyPair pty;
+    int64_t handle = 0;
+    std::array<char, 256> buffer{};
+};
+
+TEST_F(SyscallBudgetTest, Open)
+{
+    const SyscallCounts counts = openMeasured();
+    ASSERT_GT(handle, 0);
+
+    // open(), TCGETS2, TCSETS2, tcflush().
+    EXPECT_EQ(counts.trace(), "oiif");
+    EXPECT_EQ(counts.total(), 4);
+}
+
+TEST_F(SyscallBudgetTest, OpenMissingDevice)
+{
+    SyscallCounts counts;
+    {
+        const SyscallCounter counter;
+        EXPECT_LT(serialOpen(const_cast<char *>("/dev/does-not-exist"), 115200, 8, 0, 1, nullptr), 0);
+        counts = counter.counts();
+    }
+    EXPECT_EQ(counts.trace(), "o");
+}
+
+TEST_F(SyscallBudgetTest, Close)
+{
+    handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    SyscallCounts counts;
+    {
+        const SyscallCounter counter;
+        EXPECT_EQ(serialClose(handle, nullptr), 0);
+        counts = counter.counts();
+    }
+    handle = 0;
+    EXPECT_EQ(counts.trace(), "c");
+}
+
+TEST_F(SyscallBudgetTest, WriteThatFits)
+{
+    handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    SyscallCounts counts;
+    {
+        const SyscallCounter counter;
+        EXPECT_EQ(serialWrite(handle, "ping", 4, 100, 0, nullptr), 4);
+        counts = counter.counts();
+    }
+    // One write() and the drain the API promises; no readiness wait up front.
+    EXPECT_EQ(counts.trace(), "wd");
+}
+
+TEST_F(SyscallBudgetTest, WriteIntoFullQueueTimesOut)
+{
+    handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    // Suspend output first, as a device's XOFF would: the pty otherwise keeps moving queued bytes to the master in
+    // the background, and a write() measured after the fill could find room again.
+    ASSERT_EQ(tcflow(static_cast<int>(handle), TCOOFF), 0);
+    std::array<char, 4096> chunk{};
+    while (write(static_cast<int>(handle), chunk.data(), chunk.size()) > 0)
+    {
+    }
+    ASSERT_TRUE(errno == EAGAIN || errno == EWOULDBLOCK);
+
+    SyscallCounts counts;
+    {
+        const SyscallCounter counter;
+        EXPECT_EQ(serialWrite(handle, "x", 1, 10, 0, nullptr), 0);
+        counts = counter.counts();
+    }
+    tcflow(static_cast<int>(handle), TCOON);
+    // The failed write() and one wait for the whole timeout; no retry loop.
+    EXPECT_EQ(counts.trace(), "wp");
+}
+
+TEST_F(SyscallBudgetTest, ReadWithData)
+{
+    handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+    ASSERT_EQ(write(pty.master_fd, "data", 4), 4);
+    ASSERT_TRUE(PtyPair::waitQueued(handle, 4));
+
+    SyscallCounts counts;
+    {
+        const SyscallCounter counter;
+        EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, nullptr), 4);
+        counts = counter.counts();
+    }
+    EXPECT_EQ(counts.trace(), "pr");
+}
+
+TEST_F(SyscallBudgetTest, ReadTimeoutAndNonBlocking)
+{
+    handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    SyscallCounts timed_out;
+    SyscallCounts idle;
+    {
+        const SyscallCounter counter;
+        EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 10, 0, nullptr), 0);
+        timed_out = counter.counts();
+    }
+    {
+        const SyscallCounter counter;
+        EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, nullptr), 0);
+        idle = counter.counts();
+    }
+    EXPECT_EQ(timed_out.trace(), "p");
+    // A zero timeout asks FIONREAD instead of polling.
+    EXPECT_EQ(idle.trace(), "i");
+}
+
+TEST_F(SyscallBudgetTest, InvalidArgumentsMakeNoSyscalls)
+{
+    handle = pty.openSlave();
+    ASSERT_GT(handle, 0);
+
+    SyscallCounts counts;
+    {
+        const SyscallCounter counter;
+        EXPECT_EQ(serialRead(handle, nullptr, 16, 10, 0, nullptr),
+                  static_cast<int>(cpp_core::StatusCodes::kBufferError));
+        EXPECT_EQ(serialWrite(-1, "x", 1, 10, 0, nullptr),
+                  static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+        EXPECT_LT(serialOpen(nullptr, 115200, 8, 0, 1, nullptr), 0);
+        EXPECT_LT(serialOpen(const_cast<char *>(pty.slave_path.c_str()), 1, 8, 0, 1, nullptr), 0);
+        counts = counter.counts();
+    }
+    EXPECT_EQ(counts.total(), 0);
+}
+
+TEST_F(SyscallBudgetTest, RequestResponseCycle)
+{
+    // The common pattern end to end: open, send a command, read the answer, close. The device side runs between
+    // the two measured parts, since its own read()/write() would be counted too.
+    SyscallCounts request;
+    {
+        const SyscallCounter counter;
+        handle = pty.openSlave();
+        ASSERT_GT(handle, 0);
+        ASSERT_EQ(serialWrite(handle, "AT\r", 3, 100, 0, nullptr), 3);
+        request = counter.counts();
+    }
+    ASSERT_EQ(read(pty.master_fd, buffer.data(), buffer.size()), 3);
+    ASSERT_EQ(write(pty.master_fd, "OK\r\n", 4), 4);
+    ASSERT_TRUE(PtyPair::waitQueued(handle, 4));
+
+    SyscallCounts response;
+    {
+        const SyscallCounter counter;
+        ASSERT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, nullptr), 4);
+        ASSERT_EQ(serialClose(handle, nullptr), 0);
+        handle = 0;
+        response = counter.counts();
+    }
+    EXPECT_EQ(request.trace() + response.trace(), "oiifwdprc");
+    EXPECT_EQ(request.total() + response.total(), 9);
+}
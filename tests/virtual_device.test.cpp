@@ -0,0 +1,167 @@
+// Timing and fault-injection tests against a simulated device on a pseudo-terminal (see
+// src/test_helpers/virtual_device.hpp). They run everywhere, unlike serial_arduino.test.cpp.
+
+#include <cpp_bindings_linux/interface/serial_write_all.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/virtual_device.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Reads until expected_size bytes arrived or timeout_ms passed in total.
+auto readAtLeast(int64_t handle, std::size_t expected_size, int timeout_ms) -> std::string
+{
+    std::string result;
+    std::array<char, 256> buffer{};
+    const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (result.size() < expected_size && Clock::now() < deadline)
+    {
+        const int bytes = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 10, 0, nullptr);
+        if (bytes < 0)
+        {
+            break;
+        }
+        result.append(buffer.data(), static_cast<std::size_t>(bytes));
+    }
+    return result;
+}
+
+auto elapsedMs(Clock::time_point start) -> int64_t
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+}
+} // namespace
+
+class VirtualDeviceTest : public ::testing::Test
+{
+  protected:
+    auto start(VirtualDeviceOptions options, VirtualDevice::Responder responder = VirtualDevice::echo()) -> bool
+    {
+        device = std::make_unique<VirtualDevice>(options, std::move(responder));
+        if (!device->valid())
+        {
+            return false;
+        }
+        handle = device->openHost();
+        return handle > 0;
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+        device.reset();
+    }
+
+    std::unique_ptr<VirtualDevice> device;
+    int64_t handle = 0;
+};
+
+TEST_F(VirtualDeviceTest, EchoIsPacedAtTheConfiguredBaudRate)
+{
+    // 9600 baud 8N1 moves 960 bytes/s: 96 bytes need 100 ms on the wire in each direction.
+    if (!start(VirtualDeviceOptions{.baudrate = 9600}))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    const std::string message(96, 'p');
+    const auto begin = Clock::now();
+    ASSERT_EQ(serialWriteAll(handle, message.data(), static_cast<int>(message.size()), 1000, 0, nullptr),
+              static_cast<int>(message.size()));
+    const std::string echoed = readAtLeast(handle, message.size(), 2000);
+    const int64_t elapsed = elapsedMs(begin);
+
+    EXPECT_EQ(echoed, message);
+    EXPECT_GE(elapsed, 95);
+    EXPECT_LT(elapsed, 1000);
+}
+
+TEST_F(VirtualDeviceTest, LatencyTriggersReadTimeouts)
+{
+    if (!start(VirtualDeviceOptions{.latency = std::chrono::milliseconds(80)}))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    ASSERT_EQ(serialWrite(handle, "?", 1, 100, 0, nullptr), 1);
+
+    std::array<char, 8> buffer{};
+    EXPECT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 20, 0, nullptr), 0);
+    EXPECT_EQ(readAtLeast(handle, 1, 1000), "?");
+}
+
+TEST_F(VirtualDeviceTest, DroppedBytesNeverArrive)
+{
+    if (!start(VirtualDeviceOptions{.baudrate = 1'000'000, .drop_probability = 0.25, .seed = 7}))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    const std::string payload(400, 'd');
+    device->send(payload);
+    const std::string received = readAtLeast(handle, payload.size(), 300);
+
+    EXPECT_GT(device->bytesDropped(), 0U);
+    EXPECT_EQ(received.size() + device->bytesDropped(), payload.size());
+}
+
+TEST_F(VirtualDeviceTest, BurstsArriveWhole)
+{
+    if (!start(VirtualDeviceOptions{.baudrate = 38400, .burst_bytes = 32}))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    device->send(std::string(64, 'b'));
+
+    std::array<char, 128> buffer{};
+    const int first = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 500, 0, nullptr);
+    EXPECT_EQ(first % 32, 0);
+    EXPECT_GE(first, 32);
+}
+
+TEST_F(VirtualDeviceTest, HangupEndsReadsPromptly)
+{
+    if (!start(VirtualDeviceOptions{}))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    device->hangup();
+
+    std::array<char, 8> buffer{};
+    const auto begin = Clock::now();
+    const int result = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 1000, 0, nullptr);
+    EXPECT_LE(result, 0);
+    EXPECT_LT(elapsedMs(begin), 500);
+}
+
+TEST_F(VirtualDeviceTest, DeviceSeesWhatTheHostWrote)
+{
+    if (!start(VirtualDeviceOptions{}, VirtualDevice::Responder()))
+    {
+        GTEST_SKIP() << "No pseudo-terminal available";
+    }
+
+    ASSERT_EQ(serialWrite(handle, "AT\r", 3, 100, 0, nullptr), 3);
+    const auto deadline = Clock::now() + std::chrono::seconds(1);
+    while (device->received().size() < 3 && Clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(device->received(), "AT\r");
+}
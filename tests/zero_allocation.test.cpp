@@ -0,0 +1,226 @@
+// The read/write hot path must not touch the heap: serialRead(), serialWrite() and their nanosecond variants are
+// called in tight loops, and an allocation there is a lock in the allocator and a latency spike. Every call below
+// runs under an AllocationCounter after one warm-up call, and the success, timeout and error paths are all covered.
+// The error callback copies the message into a fixed buffer, so the callback itself does not allocate either.
+
+#include <cpp_bindings_linux/interface/serial_compression.h>
+#include <cpp_bindings_linux/interface/serial_timeout_ns.h>
+#include <cpp_bindings_linux/interface/serial_write_pacing.h>
+#include <cpp_core/interface/serial_close.h>
+#include <cpp_core/interface/serial_read.h>
+#include <cpp_core/interface/serial_write.h>
+#include <cpp_core/status_codes.h>
+
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "test_helpers/allocation_counter.hpp"
+#include "test_helpers/pty_pair.hpp"
+
+namespace
+{
+struct StaticErrorCapture
+{
+    static inline int last_code = 0;
+    static inline std::array<char, 256> last_message{};
+
+    static void callback(int code, const char *message)
+    {
+        last_code = code;
+        std::strncpy(last_message.data(), message != nullptr ? message : "", last_message.size() - 1);
+    }
+};
+
+// Keeps the compiler from eliding a new/delete pair whose result is never used.
+auto keepAlive(const void *pointer) -> void
+{
+    asm volatile("" : : "g"(pointer) : "memory");
+}
+} // namespace
+
+class ZeroAllocationTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!AllocationCounter::supported())
+        {
+            GTEST_SKIP() << "Allocation counting is not available under sanitizers";
+        }
+        if (!pty.valid())
+        {
+            GTEST_SKIP() << "No pseudo-terminal available";
+        }
+        handle = pty.openSlave();
+        ASSERT_GT(handle, 0);
+        StaticErrorCapture::last_code = 0;
+    }
+
+    void TearDown() override
+    {
+        if (handle > 0)
+        {
+            serialClose(handle, nullptr);
+        }
+    }
+
+    PtyPair pty;
+    int64_t handle = 0;
+    std::array<char, 256> buffer{};
+};
+
+TEST_F(ZeroAllocationTest, CounterSeesAllocations)
+{
+    // Guards against the interposition silently not taking effect, which would make every other test pass.
+    int allocations = 0;
+    {
+        const AllocationCounter counter;
+        const auto probe = std::make_unique<std::array<char, 64>>();
+        keepAlive(probe.get());
+        allocations = counter.count();
+    }
+    EXPECT_GE(allocations, 1);
+}
+
+TEST_F(ZeroAllocationTest, ReadAndWriteWithData)
+{
+    const ErrorCallbackT callback = &StaticErrorCapture::callback;
+    ASSERT_EQ(serialWrite(handle, "warm", 4, 100, 0, callback), 4);
+    ASSERT_EQ(write(pty.master_fd, "warm", 4), 4);
+    ASSERT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, callback), 4);
+
+    ASSERT_EQ(write(pty.master_fd, "abcdefgh", 8), 8);
+    int written = 0;
+    int written_ns = 0;
+    int read_ms = 0;
+    int read_ns = 0;
+    int allocations = 0;
+    {
+        const AllocationCounter counter;
+        written = serialWrite(handle, "ping", 4, 100, 0, callback);
+        written_ns = serialWriteNs(handle, "pong", 4, 100'000'000, callback);
+        read_ms = serialRead(handle, buffer.data(), 4, 100, 0, callback);
+        read_ns = serialReadNs(handle, buffer.data(), 4, 100'000'000, callback);
+        allocations = counter.count();
+    }
+    EXPECT_EQ(written, 4);
+    EXPECT_EQ(written_ns, 4);
+    EXPECT_EQ(read_ms, 4);
+    EXPECT_EQ(read_ns, 4);
+    EXPECT_EQ(allocations, 0);
+    EXPECT_EQ(StaticErrorCapture::last_code, 0);
+}
+
+TEST_F(ZeroAllocationTest, TimeoutsAndZeroTimeout)
+{
+    const ErrorCallbackT callback = &StaticErrorCapture::callback;
+    ASSERT_EQ(serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, callback), 0);
+
+    int timed_out = -1;
+    int timed_out_ns = -1;
+    int immediate = -1;
+    int allocations = 0;
+    {
+        const AllocationCounter counter;
+        timed_out = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 5, 0, callback);
+        timed_out_ns = serialReadNs(handle, buffer.data(), static_cast<int>(buffer.size()), 500'000, callback);
+        immediate = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 0, 0, callback);
+        allocations = counter.count();
+    }
+    EXPECT_EQ(timed_out, 0);
+    EXPECT_EQ(timed_out_ns, 0);
+    EXPECT_EQ(immediate, 0);
+    EXPECT_EQ(allocations, 0);
+}
+
+TEST_F(ZeroAllocationTest, ErrorPathsReportWithoutAllocating)
+{
+    const ErrorCallbackT callback = &StaticErrorCapture::callback;
+
+    // A descriptor opened for the wrong direction fails in read()/write() with EBADF, which goes through the
+    // errno formatting of failErrno().
+    const int write_only = open("/dev/null", O_WRONLY);
+    const int read_only = open("/dev/null", O_RDONLY);
+    ASSERT_GE(write_only, 0);
+    ASSERT_GE(read_only, 0);
+    ASSERT_LT(serialRead(write_only, buffer.data(), static_cast<int>(buffer.size()), 10, 0, callback), 0);
+
+    int invalid_buffer = 0;
+    int invalid_handle = 0;
+    int read_error = 0;
+    int write_error = 0;
+    int allocations = 0;
+    {
+        const AllocationCounter counter;
+        invalid_buffer = serialRead(handle, nullptr, 16, 10, 0, callback);
+        invalid_handle = serialWrite(-1, "x", 1, 10, 0, callback);
+        read_error = serialRead(write_only, buffer.data(), static_cast<int>(buffer.size()), 10, 0, callback);
+        write_error = serialWrite(read_only, "x", 1, 10, 0, callback);
+        allocations = counter.count();
+    }
+    close(write_only);
+    close(read_only);
+
+    EXPECT_EQ(invalid_buffer, static_cast<int>(cpp_core::StatusCodes::kBufferError));
+    EXPECT_EQ(invalid_handle, static_cast<int>(cpp_core::StatusCodes::kInvalidHandleError));
+    EXPECT_EQ(read_error, static_cast<int>(cpp_core::StatusCodes::kReadError));
+    EXPECT_EQ(write_error, static_cast<int>(cpp_core::StatusCodes::kWriteError));
+    EXPECT_EQ(allocations, 0);
+    EXPECT_EQ(StaticErrorCapture::last_code, static_cast<int>(cpp_core::StatusCodes::kWriteError));
+    EXPECT_GT(std::strlen(StaticErrorCapture::last_message.data()), 0U);
+}
+
+TEST_F(ZeroAllocationTest, CompressedModeAfterEnabling)
+{
+    const RegisteredMaster master(pty.master_fd);
+    const ErrorCallbackT callback = &StaticErrorCapture::callback;
+    ASSERT_EQ(serialSetCompression(handle, 1, callback), 0);
+    ASSERT_EQ(serialSetCompression(pty.master_fd, 1, callback), 0);
+
+    // The buffers are reserved when the mode is enabled, so even the first frame in each direction is free.
+    static constexpr std::array<char, 28> kMessage{"temp=21.5 hum=40 status=OK\n"};
+    const int size = static_cast<int>(kMessage.size() - 1);
+    int sent = 0;
+    int received = 0;
+    int echoed = 0;
+    int received_back = 0;
+    int allocations = 0;
+    {
+        const AllocationCounter counter;
+        sent = serialWrite(pty.master_fd, kMessage.data(), size, 100, 0, callback);
+        received = serialRead(handle, buffer.data(), static_cast<int>(buffer.size()), 100, 0, callback);
+        echoed = serialWrite(handle, buffer.data(), received, 100, 0, callback);
+        received_back = serialRead(pty.master_fd, buffer.data(), static_cast<int>(buffer.size()), 100, 0, callback);
+        allocations = counter.count();
+    }
+    EXPECT_EQ(sent, size);
+    EXPECT_EQ(received, size);
+    EXPECT_EQ(echoed, size);
+    EXPECT_EQ(received_back, size);
+    EXPECT_EQ(allocations, 0);
+    EXPECT_EQ(std::memcmp(buffer.data(), kMessage.data(), static_cast<std::size_t>(size)), 0);
+}
+
+TEST_F(ZeroAllocationTest, PacedWriteQueuesWithoutAllocating)
+{
+    const ErrorCallbackT callback = &StaticErrorCapture::callback;
+    ASSERT_EQ(serialSetWritePacing(handle, 10, 1024, callback), 0);
+
+    int queued = 0;
+    int allocations = 0;
+    {
+        const AllocationCounter counter;
+        queued = serialWritePaced(handle, "paced", 5, 100, callback);
+        queued += serialWritePriority(handle, "stop", 4, kSerialWriteLaneUrgent, 100, callback);
+        allocations = counter.count();
+    }
+    EXPECT_EQ(queued, 9);
+    EXPECT_EQ(allocations, 0);
+    EXPECT_TRUE(PtyPair::waitQueued(pty.master_fd, 9));
+    ASSERT_EQ(serialSetWritePacing(handle, 0, 0, callback), 0);
+}